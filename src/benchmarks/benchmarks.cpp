@@ -2,14 +2,24 @@
 #include <nanobench.h>
 
 #include <rpp/rpp.hpp>
+#include <rpp/schedulers/details/queue.hpp>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdlib>
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <latch>
 #include <map>
+#include <new>
 #include <span>
+#include <string>
 #include <string_view>
+#include <thread>
 #include <tuple>
+#include <vector>
 #ifdef RPP_BUILD_RXCPP
     #include <rxcpp/rx.hpp>
 #endif
@@ -22,6 +32,13 @@
     if (!section.has_value() || std::string_view{NAME}.find(section.value()) != std::string_view::npos)
 #define TEST_RPP(...) \
     if (!disable_rpp) bench.context("source", "rpp").run(__VA_ARGS__)
+#define TEST_RPP_COUNTING_ALLOCATIONS(FN)                                     \
+    if (!disable_rpp)                                                         \
+    {                                                                         \
+        bench.context("allocations", count_allocations_per_call(FN).c_str()); \
+        TEST_RPP(FN);                                                         \
+        bench.context("allocations", "-");                                    \
+    }
 #ifdef RPP_BUILD_RXCPP
     #define TEST_RXCPP(...) \
         if (!disable_rxcpp) bench.context("source", "rxcpp").run(__VA_ARGS__)
@@ -36,6 +53,10 @@ char const * json() noexcept
             "title": "{{context(benchmark_title)}}",
             "name": "{{context(benchmark_name)}}",
             "source" : "{{context(source)}}",
+            "allocations": "{{context(allocations)}}",
+            "rss_growth_kb": "{{context(rss_growth_kb)}}",
+            "p50_ns": "{{context(p50_ns)}}",
+            "p99_ns": "{{context(p99_ns)}}",
             "median(elapsed)": {{median(elapsed)}},
             "medianAbsolutePercentError(elapsed)": {{medianAbsolutePercentError(elapsed)}}
         }{{^-last}},{{/-last}}
@@ -43,6 +64,133 @@ char const * json() noexcept
 ])DELIM";
 }
 
+namespace
+{
+    thread_local size_t s_allocations_count{};
+} // namespace
+
+// global operator new is replaced to count amount of heap allocations done by the current thread
+void* operator new(size_t size)
+{
+    ++s_allocations_count;
+    if (auto* ptr = std::malloc(size == 0 ? 1 : size))
+        return ptr;
+    throw std::bad_alloc{};
+}
+
+// not inlined to prevent false-positive mismatched new/delete (malloc/free) warnings
+[[gnu::noinline]] void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+[[gnu::noinline]] void operator delete(void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
+
+/**
+ * @brief Returns average amount of heap allocations done by the current thread per one call of `fn`
+ */
+std::string count_allocations_per_call(const auto& fn)
+{
+    constexpr size_t calls_count = 1000;
+
+    // warm-up to fill any caches
+    fn();
+
+    const auto before = s_allocations_count;
+    for (size_t i = 0; i < calls_count; ++i)
+        fn();
+
+    return std::to_string(static_cast<double>(s_allocations_count - before) / calls_count);
+}
+
+/**
+ * @brief Returns resident set size of the current process in kilobytes (if supported for current platform)
+ */
+std::optional<long long> get_rss_kb()
+{
+#ifdef __linux__
+    std::ifstream status{"/proc/self/status"};
+    for (std::string line; std::getline(status, line);)
+    {
+        if (line.starts_with("VmRSS:"))
+            return std::stoll(line.substr(6));
+    }
+#endif
+    return std::nullopt;
+}
+
+/**
+ * @brief Bounces schedulable between two workers: each hop is scheduled from the thread of the previous one
+ */
+template<typename Worker>
+class ping_pong
+{
+public:
+    ping_pong(Worker first, Worker second)
+        : m_workers{std::move(first), std::move(second)}
+    {
+    }
+
+    ping_pong(const ping_pong&) = delete;
+    ping_pong(ping_pong&&)      = delete;
+
+    /**
+     * @brief Makes `hops` hops and returns latency of each of them
+     */
+    const std::vector<rpp::schedulers::duration>& run(size_t hops)
+    {
+        m_latencies.clear();
+        m_latencies.reserve(hops);
+        m_hops_left = hops;
+        m_done.store(false);
+
+        send(0, rpp::schedulers::clock_type::now());
+        m_done.wait(false);
+        return m_latencies;
+    }
+
+private:
+    void send(size_t target, rpp::schedulers::time_point sent)
+    {
+        m_workers[target].schedule([this, target, sent](const auto&) {
+            const auto now = rpp::schedulers::clock_type::now();
+            m_latencies.push_back(now - sent);
+            if (--m_hops_left == 0)
+            {
+                m_done.store(true);
+                m_done.notify_one();
+            }
+            else
+                send(1 - target, now);
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                                   m_observer);
+    }
+
+private:
+    std::array<Worker, 2>                  m_workers;
+    rpp::dynamic_observer<int>             m_observer = rpp::make_lambda_observer([](int) {}).as_dynamic();
+    std::vector<rpp::schedulers::duration> m_latencies{};
+    size_t                                 m_hops_left{};
+    std::atomic_bool                       m_done{};
+};
+
+/**
+ * @brief Returns provided percentile (in range [0;1]) of latencies in nanoseconds
+ */
+std::string get_percentile_ns(std::vector<rpp::schedulers::duration> latencies, double percentile)
+{
+    if (latencies.empty())
+        return "-";
+
+    const auto index = std::min(latencies.size() - 1, static_cast<size_t>(percentile * static_cast<double>(latencies.size())));
+    std::nth_element(latencies.begin(), latencies.begin() + static_cast<std::ptrdiff_t>(index), latencies.end());
+    return std::to_string(latencies[index].count());
+}
+
 std::optional<std::string_view> find_argument(std::string_view target_argument, std::span<char*> args)
 {
     for (const auto raw_argument : args)
@@ -65,6 +213,16 @@ namespace rpp
     }
 } // namespace rpp
 
+struct is_zero
+{
+    bool operator()(int v) const { return v == 0; }
+};
+
+template<>
+struct rpp::utils::is_stateless_callable<is_zero> : std::true_type
+{
+};
+
 #ifdef RPP_BUILD_RXCPP
 namespace rxcpp
 {
@@ -86,6 +244,11 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
     const auto                  disable_rpp   = find_argument("--disable_rpp", args).has_value();
     const auto                  dump          = find_argument("--dump=", args);
 
+    bench.context("allocations", "-");
+    bench.context("rss_growth_kb", "-");
+    bench.context("p50_ns", "-");
+    bench.context("p99_ns", "-");
+
     BENCHMARK("General")
     {
         SECTION("Subscribe empty callbacks to empty observable")
@@ -121,6 +284,65 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
                     | rxcpp::operators::subscribe<int>([](int) {});
             });
         }
+
+        SECTION("Subscribe empty callbacks to as_dynamic() observable with upstream disposable")
+        {
+            TEST_RPP_COUNTING_ALLOCATIONS([&]() {
+                rpp::source::create<int>([&](auto&& observer) {
+                    observer.set_upstream(rpp::make_callback_disposable([]() noexcept {}));
+                })
+                    .as_dynamic()
+                    .subscribe([](int) {});
+            });
+        }
+
+        SECTION("Subscribe empty callbacks to as_dynamic() observable with upstream disposable + map + as_dynamic()")
+        {
+            TEST_RPP_COUNTING_ALLOCATIONS([&]() {
+                rpp::source::create<int>([&](auto&& observer) {
+                    observer.set_upstream(rpp::make_callback_disposable([]() noexcept {}));
+                })
+                    .as_dynamic()
+                    .pipe(rpp::operators::map([](int v) { return v * 2; }))
+                    .as_dynamic()
+                    .subscribe([](int) {});
+            });
+        }
+
+        SECTION("Subscribe empty callbacks to publish_subject as_dynamic() observable with disposable")
+        {
+            const rpp::subjects::publish_subject<int> subject{};
+            TEST_RPP_COUNTING_ALLOCATIONS([&]() {
+                subject.get_observable()
+                    .as_dynamic()
+                    .subscribe_with_disposable([](int) {})
+                    .dispose();
+            });
+        }
+
+        SECTION("Convert lambda observer to dynamic_observer and emit")
+        {
+            TEST_RPP_COUNTING_ALLOCATIONS([&]() {
+                const auto observer = rpp::make_lambda_observer([](int v) { ankerl::nanobench::doNotOptimizeAway(v); }).as_dynamic();
+                observer.on_next(1);
+            });
+        }
+
+        SECTION("Convert just(1) to dynamic_observable and copy")
+        {
+            TEST_RPP_COUNTING_ALLOCATIONS([&]() {
+                const auto observable = rpp::source::just(1).as_dynamic();
+                const auto copy       = observable;
+                ankerl::nanobench::doNotOptimizeAway(copy);
+            });
+        }
+
+        SECTION("Subscribe empty callbacks to just(1).as_dynamic()")
+        {
+            TEST_RPP_COUNTING_ALLOCATIONS([&]() {
+                rpp::source::just(1).as_dynamic().subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
     }; // BENCHMARK("General")
 
     BENCHMARK("Sources")
@@ -174,6 +396,35 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
             });
         }
 
+        SECTION("from array of 1000 - create + filter + publish_subject with 4 dynamic subscribers + immediate")
+        {
+            std::array<int, 1000> vals{};
+            TEST_RPP([&]() {
+                rpp::subjects::publish_subject<int> subj{};
+                for (size_t i = 0; i < 4; ++i)
+                    subj.get_observable().as_dynamic().subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+
+                rpp::source::from_iterable(vals, rpp::schedulers::immediate{}) | rpp::ops::filter(is_zero{}) | rpp::ops::subscribe(subj.get_observer());
+            });
+
+            TEST_RXCPP([&]() {
+                rxcpp::subjects::subject<int> subj{};
+                for (size_t i = 0; i < 4; ++i)
+                    subj.get_observable().as_dynamic().subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+
+                (rxcpp::observable<>::iterate(vals, rxcpp::identity_immediate()) | rxcpp::operators::filter([](int v) { return v == 0; })).subscribe(subj.get_subscriber());
+            });
+        }
+
+        SECTION("from array of 1000 - create + with_demand requesting 1 per value + subscribe + immediate")
+        {
+            std::array<int, 1000> vals{};
+            TEST_RPP([&]() {
+                const auto demand = rpp::demand::make(1);
+                rpp::source::from_iterable(vals, rpp::schedulers::immediate{}) | rpp::ops::with_demand(demand) | rpp::ops::subscribe([&demand](int v) { ankerl::nanobench::doNotOptimizeAway(v); demand.request(1); });
+            });
+        }
+
         SECTION("concat_as_source of just(1 immediate) create + subscribe")
         {
             TEST_RPP([&]() {
@@ -234,7 +485,7 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
     {
         SECTION("immediate scheduler create worker + schedule")
         {
-            TEST_RPP([&]() {
+            TEST_RPP_COUNTING_ALLOCATIONS([&]() {
                 rpp::schedulers::immediate::create_worker().schedule([](const auto& v) { ankerl::nanobench::doNotOptimizeAway(v); return rpp::schedulers::optional_delay_from_now{}; }, rpp::make_lambda_observer([](int) {}));
             });
             TEST_RXCPP([&]() {
@@ -244,7 +495,7 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
 
         SECTION("current_thread scheduler create worker + schedule")
         {
-            TEST_RPP([&]() {
+            TEST_RPP_COUNTING_ALLOCATIONS([&]() {
                 rpp::schedulers::current_thread::create_worker().schedule([](const auto& v) { ankerl::nanobench::doNotOptimizeAway(v); return rpp::schedulers::optional_delay_from_now{}; }, rpp::make_lambda_observer([](int) {}));
             });
             TEST_RXCPP([&]() {
@@ -252,9 +503,17 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
             });
         }
 
+        SECTION("instrumented current_thread scheduler with statistics create worker + schedule")
+        {
+            const auto scheduler = rpp::schedulers::instrumented{rpp::schedulers::current_thread{}, rpp::schedulers::scheduler_statistics{}};
+            TEST_RPP_COUNTING_ALLOCATIONS([&]() {
+                scheduler.create_worker().schedule([](const auto& v) { ankerl::nanobench::doNotOptimizeAway(v); return rpp::schedulers::optional_delay_from_now{}; }, rpp::make_lambda_observer([](int) {}));
+            });
+        }
+
         SECTION("current_thread scheduler create worker + schedule + recursive schedule")
         {
-            TEST_RPP(
+            TEST_RPP_COUNTING_ALLOCATIONS(
                 [&]() {
                     const auto worker = rpp::schedulers::current_thread::create_worker();
                     worker.schedule(
@@ -280,8 +539,258 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
                     });
                 });
         }
+
+        for (const size_t pending_count : {size_t{10'000}, size_t{100'000}})
+        {
+            const auto fill_queue = [pending_count](auto& queue, const auto& obs) {
+                for (size_t i = 0; i < pending_count; ++i)
+                    queue.emplace(rpp::schedulers::time_point{std::chrono::milliseconds{(i * 7919) % pending_count}}, [](const auto&) { return rpp::schedulers::optional_delay_from_now{}; }, obs);
+            };
+
+            SECTION(("schedulables_queue with " + std::to_string(pending_count) + " pending timers - emplace timer + pop").c_str())
+            {
+                const auto                                                                                     obs = rpp::make_lambda_observer([](int) {}).as_dynamic();
+                rpp::schedulers::details::schedulables_queue<rpp::schedulers::current_thread::worker_strategy> queue{};
+                fill_queue(queue, obs);
+
+                size_t i{};
+                TEST_RPP_COUNTING_ALLOCATIONS([&]() {
+                    queue.emplace(rpp::schedulers::time_point{std::chrono::milliseconds{(i++ * 7919) % pending_count}}, [](const auto&) { return rpp::schedulers::optional_delay_from_now{}; }, obs);
+                    ankerl::nanobench::doNotOptimizeAway(queue.pop());
+                });
+            }
+
+            SECTION(("schedulables_queue with " + std::to_string(pending_count) + " pending timers - emplace now + pop").c_str())
+            {
+                const auto                                                                                     obs = rpp::make_lambda_observer([](int) {}).as_dynamic();
+                rpp::schedulers::details::schedulables_queue<rpp::schedulers::current_thread::worker_strategy> queue{};
+                fill_queue(queue, obs);
+
+                TEST_RPP_COUNTING_ALLOCATIONS([&]() {
+                    queue.emplace(rpp::schedulers::time_point{}, [](const auto&) { return rpp::schedulers::optional_delay_from_now{}; }, obs);
+                    ankerl::nanobench::doNotOptimizeAway(queue.pop());
+                });
+            }
+        }
+
+        for (const size_t producers_count : {size_t{1}, size_t{4}, size_t{16}})
+        {
+            SECTION(("new_thread worker fed by " + std::to_string(producers_count) + " producers - 16384 schedules").c_str())
+            {
+                constexpr size_t total_schedules = 16'384;
+
+                const auto obs    = rpp::make_lambda_observer([](int) {}).as_dynamic();
+                const auto worker = rpp::schedulers::new_thread::create_worker();
+
+                TEST_RPP([&]() {
+                    std::latch               done{total_schedules};
+                    std::vector<std::thread> producers{};
+                    producers.reserve(producers_count);
+                    for (size_t p = 0; p < producers_count; ++p)
+                    {
+                        producers.emplace_back([&]() {
+                            for (size_t i = 0; i < total_schedules / producers_count; ++i)
+                            {
+                                worker.schedule([&done](const auto&) {
+                                    done.count_down();
+                                    return rpp::schedulers::optional_delay_from_now{};
+                                },
+                                                obs);
+                            }
+                        });
+                    }
+                    for (auto& producer : producers)
+                        producer.join();
+                    done.wait();
+                });
+            }
+        }
+
+        SECTION("new_thread worker fed by 1 producer via schedule_batch(64) - 16384 schedules")
+        {
+            constexpr size_t total_schedules = 16'384;
+            constexpr size_t batch_size      = 64;
+
+            const auto obs    = rpp::make_lambda_observer([](int) {}).as_dynamic();
+            const auto worker = rpp::schedulers::new_thread::create_worker();
+
+            TEST_RPP([&]() {
+                std::latch done{total_schedules};
+                for (size_t i = 0; i < total_schedules / batch_size; ++i)
+                {
+                    worker.schedule_batch([&](auto& batch) {
+                        for (size_t j = 0; j < batch_size; ++j)
+                        {
+                            batch.schedule([&done](const auto&) {
+                                done.count_down();
+                                return rpp::schedulers::optional_delay_from_now{};
+                            },
+                                           obs);
+                        }
+                    });
+                }
+                done.wait();
+            });
+        }
+
+        for (const auto& [policy_name, policy] : {std::pair{"blocking", rpp::schedulers::idle_policy::blocking()},
+                                                  std::pair{"spin_then_park", rpp::schedulers::idle_policy::spin_then_park()},
+                                                  std::pair{"hot", rpp::schedulers::idle_policy::hot()}})
+        {
+            SECTION(("ping-pong between two new_thread workers with " + std::string{policy_name} + " idle policy - 1000 hops").c_str())
+            {
+                ping_pong<decltype(rpp::schedulers::new_thread::create_worker())> pp{rpp::schedulers::new_thread::create_worker(policy), rpp::schedulers::new_thread::create_worker(policy)};
+
+                const auto& latencies = pp.run(10'000);
+                bench.context("p50_ns", get_percentile_ns(latencies, 0.5).c_str());
+                bench.context("p99_ns", get_percentile_ns(latencies, 0.99).c_str());
+                TEST_RPP([&]() {
+                    pp.run(1'000);
+                });
+                bench.context("p50_ns", "-");
+                bench.context("p99_ns", "-");
+            }
+        }
+
+        const auto timer_churn = [&](const auto& scheduler) {
+            constexpr size_t subscriptions_count = 10'000;
+
+            // long-living subscription keeps earlier deadline at the top of the queue, so disposed timers can't be dropped just from the top
+            const auto alive = rpp::source::timer(std::chrono::minutes{30}, scheduler).subscribe_with_disposable([](size_t) {});
+            const auto churn = [&]() {
+                for (size_t i = 0; i < subscriptions_count; ++i)
+                {
+                    rpp::source::timer(std::chrono::hours{1}, scheduler)
+                        .subscribe_with_disposable([payload = std::vector<char>(1024)](size_t) { ankerl::nanobench::doNotOptimizeAway(payload); })
+                        .dispose();
+                }
+            };
+
+            // disposed timers are far from their deadline, so memory grows with each churn unless they are removed from any position of the queue
+            const auto rss_before = get_rss_kb();
+            for (size_t i = 0; i < 10; ++i)
+                churn();
+            const auto rss_after = get_rss_kb();
+
+            bench.context("rss_growth_kb", rss_before && rss_after ? std::to_string(rss_after.value() - rss_before.value()).c_str() : "-");
+            TEST_RPP([&]() {
+                churn();
+            });
+            bench.context("rss_growth_kb", "-");
+            alive.dispose();
+        };
+
+        SECTION("timer(1h) on thread_pool(1) subscribe + dispose churn - 10000 subscriptions")
+        {
+            timer_churn(rpp::schedulers::thread_pool{1});
+        }
+
+        SECTION("timer(1h) on timer_wheel subscribe + dispose churn - 10000 subscriptions")
+        {
+            timer_churn(rpp::schedulers::timer_wheel{});
+        }
+
+        const auto skewed_load = [](const auto& scheduler) {
+            constexpr size_t workers_count    = 16;
+            constexpr size_t tasks_per_worker = 16;
+
+            const auto obs = rpp::make_lambda_observer([](int) {}).as_dynamic();
+            std::latch done{workers_count * tasks_per_worker};
+
+            for (size_t i = 0; i < workers_count; ++i)
+            {
+                // every 4th worker is "busy" one, so all of them are pinned to same thread in round-robin thread_pool with 4 threads
+                const size_t iterations = i % 4 == 0 ? 20'000 : 100;
+                const auto   worker     = scheduler.create_worker();
+                for (size_t j = 0; j < tasks_per_worker; ++j)
+                {
+                    worker.schedule([&done, iterations](const auto&) {
+                        size_t sum{};
+                        for (size_t k = 0; k < iterations; ++k)
+                            ankerl::nanobench::doNotOptimizeAway(sum += k);
+                        done.count_down();
+                        return rpp::schedulers::optional_delay_from_now{};
+                    },
+                                    obs);
+                }
+            }
+            done.wait();
+        };
+
+        SECTION("thread_pool(4) skewed load: 16 workers, every 4th is busy")
+        {
+            const auto scheduler = rpp::schedulers::thread_pool{4};
+            TEST_RPP([&]() {
+                skewed_load(scheduler);
+            });
+        }
+
+        SECTION("work_stealing_pool(4) skewed load: 16 workers, every 4th is busy")
+        {
+            const auto scheduler = rpp::schedulers::work_stealing_pool{4};
+            TEST_RPP([&]() {
+                skewed_load(scheduler);
+            });
+        }
     } // BENCHMARK("Schedulers")
 
+    BENCHMARK("Disposables")
+    {
+        const auto contended_add_remove = [](const rpp::composite_disposable_wrapper& root) {
+            constexpr size_t threads_count         = 16;
+            constexpr size_t iterations_per_thread = 1024;
+
+            std::latch               start{threads_count};
+            std::vector<std::thread> threads{};
+            threads.reserve(threads_count);
+            for (size_t t = 0; t < threads_count; ++t)
+            {
+                threads.emplace_back([&]() {
+                    const auto child = rpp::composite_disposable_wrapper::make();
+                    start.arrive_and_wait();
+                    for (size_t i = 0; i < iterations_per_thread; ++i)
+                    {
+                        root.add(child);
+                        root.remove(child);
+                    }
+                });
+            }
+            for (auto& thread : threads)
+                thread.join();
+        };
+
+        SECTION("composite_disposable add + remove from 16 threads - 1024 iterations each")
+        {
+            const auto root = rpp::composite_disposable_wrapper::make();
+            TEST_RPP([&]() {
+                contended_add_remove(root);
+            });
+        }
+
+        SECTION("sharded_composite_disposable<16> add + remove from 16 threads - 1024 iterations each")
+        {
+            const auto root = rpp::composite_disposable_wrapper::make<rpp::sharded_composite_disposable<16>>();
+            TEST_RPP([&]() {
+                contended_add_remove(root);
+            });
+        }
+
+        SECTION("refcount_disposable add_ref for 1024 references + dispose in reverse order")
+        {
+            TEST_RPP([&]() {
+                const auto refcount = rpp::disposable_wrapper_impl<rpp::refcount_disposable>::make();
+
+                std::vector<rpp::composite_disposable_wrapper> refs{};
+                refs.reserve(1024);
+                for (size_t i = 0; i < 1024; ++i)
+                    refs.push_back(refcount.lock()->add_ref());
+
+                for (auto it = refs.rbegin(); it != refs.rend(); ++it)
+                    it->dispose();
+            });
+        }
+    } // BENCHMARK("Disposables")
+
     BENCHMARK("Combining Operators")
     {
         SECTION("immediate_just(immediate_just(1), immediate_just(1)) + merge() + subscribe")
@@ -336,6 +845,36 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
             });
         }
 
+        for (const size_t producers_count : {size_t{1}, size_t{4}, size_t{16}})
+        {
+            SECTION(("merge of " + std::to_string(producers_count) + " producers on new_thread + as_blocking + subscribe - 16384 values").c_str())
+            {
+                const std::vector<int> vals(16'384 / producers_count);
+
+                TEST_RPP([&]() {
+                    std::vector<rpp::dynamic_observable<int>> sources{};
+                    for (size_t i = 0; i < producers_count; ++i)
+                        sources.push_back(rpp::source::from_iterable(vals, rpp::schedulers::new_thread{}).as_dynamic());
+
+                    rpp::source::from_iterable(sources, rpp::schedulers::immediate{})
+                        | rpp::operators::merge()
+                        | rpp::operators::as_blocking()
+                        | rpp::operators::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+                });
+
+                TEST_RXCPP([&]() {
+                    std::vector<rxcpp::observable<int>> sources{};
+                    for (size_t i = 0; i < producers_count; ++i)
+                        sources.push_back(rxcpp::observable<>::iterate(vals, rxcpp::observe_on_new_thread()).as_dynamic());
+
+                    (rxcpp::observable<>::iterate(sources, rxcpp::identity_immediate())
+                     | rxcpp::operators::merge()
+                     | rxcpp::operators::as_blocking())
+                        .subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+                });
+            }
+        }
+
         SECTION("immediate_just(1) + with_latest_from(immediate_just(2)) + subscribe")
         {
             TEST_RPP([&]() {
@@ -633,6 +1172,66 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
                     | rxcpp::operators::subscribe<int>([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
             });
         }
+        SECTION("immediate_just(1,2,3)+subscribe_on(thread_pool(1))+observe_on(same thread_pool(1))+as_blocking+subscribe")
+        {
+            const auto pool = rpp::schedulers::thread_pool{1};
+            TEST_RPP([&]() {
+                rpp::immediate_just(1, 2, 3)
+                    | rpp::operators::subscribe_on(pool)
+                    | rpp::operators::observe_on(pool)
+                    | rpp::operators::as_blocking()
+                    | rpp::operators::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
+        for (const auto bounded : {false, true})
+        {
+            SECTION(bounded ? "from array of 1000+observe_on(run_loop, bounded queue of 1024)+subscribe+dispatch all" : "from array of 1000+observe_on(run_loop)+subscribe+dispatch all")
+            {
+                const auto            loop = rpp::schedulers::run_loop{};
+                std::array<int, 1000> vals{};
+                TEST_RPP_COUNTING_ALLOCATIONS([&]() {
+                    auto source = rpp::source::from_iterable(vals, rpp::schedulers::immediate{});
+                    if (bounded)
+                        source | rpp::operators::observe_on(loop, {.capacity = 1024, .policy = rpp::overflow_policy::drop_newest}) | rpp::operators::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+                    else
+                        source | rpp::operators::observe_on(loop) | rpp::operators::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+
+                    while (!loop.is_empty())
+                        loop.dispatch_if_ready();
+                });
+            }
+        }
+        SECTION("from array of 65536 on new_thread+observe_on(new_thread)+as_blocking+subscribe - throughput across two threads")
+        {
+            const std::vector<int> vals(65536);
+            TEST_RPP([&]() {
+                rpp::source::from_iterable(vals)
+                    | rpp::operators::subscribe_on(rpp::schedulers::new_thread{})
+                    | rpp::operators::observe_on(rpp::schedulers::new_thread{})
+                    | rpp::operators::as_blocking()
+                    | rpp::operators::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+
+            TEST_RXCPP([&]() {
+                (rxcpp::observable<>::iterate(vals)
+                 | rxcpp::operators::subscribe_on(rxcpp::observe_on_new_thread())
+                 | rxcpp::operators::observe_on(rxcpp::observe_on_new_thread())
+                 | rxcpp::operators::as_blocking())
+                    .subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
+        SECTION("never()+delay(run_loop)+merge_with(never())+debounce(run_loop)+subscribe_with_disposable+dispose")
+        {
+            const auto loop = rpp::schedulers::run_loop{};
+            TEST_RPP_COUNTING_ALLOCATIONS([&]() {
+                const auto d = rpp::source::never<int>()
+                             | rpp::operators::delay(std::chrono::seconds{1}, loop)
+                             | rpp::operators::merge_with(rpp::source::never<int>())
+                             | rpp::operators::debounce(std::chrono::seconds{1}, loop)
+                             | rpp::operators::subscribe_with_disposable([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+                d.dispose();
+            });
+        }
     } // BENCHMARK("Utility Operators")
 
     BENCHMARK("Aggregating Operators")
@@ -927,6 +1526,32 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
                     | rxcpp::operators::subscribe<int>(d, [](int) {});
             });
         }
+        SECTION("merge of 10k live inner observables completed one by one")
+        {
+            TEST_RPP([&]() {
+                std::vector<rpp::subjects::publish_subject<int>> subjects(10'000);
+
+                rpp::source::from_iterable(subjects, rpp::schedulers::immediate{})
+                    | rpp::ops::flat_map([](const rpp::subjects::publish_subject<int>& s) { return s.get_observable(); })
+                    | rpp::ops::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+
+                for (const auto& s : subjects)
+                    s.get_observer().on_completed();
+            });
+        }
+        SECTION("flat_map(max_concurrent=16) of 10k inner observables completed one by one")
+        {
+            TEST_RPP([&]() {
+                std::vector<rpp::subjects::publish_subject<int>> subjects(10'000);
+
+                rpp::source::from_iterable(subjects, rpp::schedulers::immediate{})
+                    | rpp::ops::flat_map([](const rpp::subjects::publish_subject<int>& s) { return s.get_observable(); }, 16)
+                    | rpp::ops::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+
+                for (const auto& s : subjects)
+                    s.get_observer().on_completed();
+            });
+        }
 
     } // BENCHMARK("Scenarios")
 
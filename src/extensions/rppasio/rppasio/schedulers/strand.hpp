@@ -17,6 +17,8 @@
 #include <asio/bind_executor.hpp>
 #include <asio/strand.hpp>
 
+#include <vector>
+
 namespace rppasio::schedulers
 {
     /**
@@ -74,7 +76,67 @@ namespace rppasio::schedulers
                 }));
             }
 
+            void defer_batch(std::vector<rpp::schedulers::details::schedulable_ptr>&& schedulables) const
+            {
+                // whole batch is posted as single handler: ready schedulables are executed in order of scheduling, delayed ones are deferred to own timers
+                asio::post(asio::bind_executor(m_strand, [self = this->shared_from_this(), schedulables = std::move(schedulables)]() mutable {
+                    current_thread_queue_guard guard{*self};
+                    for (auto& schedulable : schedulables)
+                    {
+                        if (schedulable->is_disposed())
+                            continue;
+
+                        if (schedulable->get_timepoint() > rpp::schedulers::clock_type::now())
+                        {
+                            self->defer_schedulable(std::move(schedulable));
+                            continue;
+                        }
+
+                        if (const auto advanced_call = schedulable->make_advanced_call())
+                        {
+                            schedulable->set_timepoint(schedulable->handle_advanced_call(*advanced_call));
+                            self->defer_schedulable(std::move(schedulable));
+                        }
+                    }
+                }));
+            }
+
         private:
+            struct schedulable_ptr_handler
+            {
+                bool is_disposed() const noexcept
+                {
+                    return m_schedulable->is_disposed();
+                }
+
+                void on_error(const std::exception_ptr& ep) const
+                {
+                    m_schedulable->on_error(ep);
+                }
+
+                rpp::schedulers::details::schedulable_ptr m_schedulable;
+            };
+
+            void defer_schedulable(rpp::schedulers::details::schedulable_ptr&& schedulable) const
+            {
+                if (schedulable->is_disposed())
+                    return;
+
+                const auto timepoint = schedulable->get_timepoint();
+                defer_with_time(
+                    timepoint,
+                    [schedulable](const auto&) -> rpp::schedulers::optional_delay_to {
+                        if (const auto advanced_call = schedulable->make_advanced_call())
+                        {
+                            const auto tp = schedulable->handle_advanced_call(*advanced_call);
+                            schedulable->set_timepoint(tp);
+                            return rpp::schedulers::delay_to{tp};
+                        }
+                        return std::nullopt;
+                    },
+                    schedulable_ptr_handler{schedulable});
+            }
+
             // Guard draining schedulables queued to thread local queue to schedule them back to strand queue
             class current_thread_queue_guard
             {
@@ -94,44 +156,11 @@ namespace rppasio::schedulers
                 current_thread_queue_guard(const current_thread_queue_guard&) = delete;
                 current_thread_queue_guard(current_thread_queue_guard&&)      = delete;
 
-            private:
-                struct handler
-                {
-                    bool is_disposed() const noexcept
-                    {
-                        return m_schedulable->is_disposed();
-                    }
-
-                    void on_error(const std::exception_ptr& ep) const
-                    {
-                        m_schedulable->on_error(ep);
-                    }
-
-                    std::shared_ptr<rpp::schedulers::details::schedulable_base> m_schedulable;
-                };
-
             private:
                 void process_queue()
                 {
                     while (!m_queue.is_empty())
-                    {
-                        const auto top = m_queue.pop();
-                        if (top->is_disposed())
-                            continue;
-
-                        m_state.defer_with_time(
-                            top->get_timepoint(),
-                            [top](const auto&) -> rpp::schedulers::optional_delay_to {
-                                if (const auto advanced_call = top->make_advanced_call())
-                                {
-                                    const auto tp = top->handle_advanced_call(*advanced_call);
-                                    top->set_timepoint(tp);
-                                    return rpp::schedulers::delay_to{tp};
-                                }
-                                return std::nullopt;
-                            },
-                            handler{top});
-                    }
+                        m_state.defer_schedulable(m_queue.pop());
                     rpp::schedulers::current_thread::get_queue() = nullptr;
                 }
 
@@ -168,6 +197,11 @@ namespace rppasio::schedulers
                 m_state->defer_with_time(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
             }
 
+            void defer_batch(std::vector<rpp::schedulers::details::schedulable_ptr>&& schedulables) const
+            {
+                m_state->defer_batch(std::move(schedulables));
+            }
+
             static rpp::schedulers::time_point now() { return rpp::schedulers::clock_type::now(); }
 
         private:
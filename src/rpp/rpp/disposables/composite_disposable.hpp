@@ -12,11 +12,17 @@
 
 #include <rpp/disposables/fwd.hpp>
 
+#include <rpp/disposables/details/composite_state.hpp>
 #include <rpp/disposables/details/container.hpp>
+#include <rpp/disposables/details/control_block.hpp>
 #include <rpp/disposables/disposable_wrapper.hpp>
 #include <rpp/disposables/interface_composite_disposable.hpp>
 
+#include <array>
 #include <atomic>
+#include <cstddef>
+#include <functional>
+#include <optional>
 
 namespace rpp
 {
@@ -28,6 +34,7 @@ namespace rpp
      */
     template<details::disposables::constraint::disposables_container Container>
     class composite_disposable_impl : public interface_composite_disposable
+        , public details::disposed_flag_publisher
     {
     public:
         composite_disposable_impl()                                           = default;
@@ -36,27 +43,18 @@ namespace rpp
 
         bool is_disposed() const noexcept final
         {
-            // just need atomicity, not guarding anything
-            return m_current_state.load(std::memory_order::seq_cst) == State::Disposed;
+            return m_state.is_disposed();
         }
 
         void dispose_impl(interface_disposable::Mode mode) noexcept final
         {
-            while (true)
+            if (m_state.dispose())
             {
-                State expected{State::None};
-                // need to acquire possible state changing from `add`
-                if (m_current_state.compare_exchange_strong(expected, State::Disposed, std::memory_order::seq_cst))
-                {
-                    composite_dispose_impl(mode);
-
-                    m_disposables.dispose();
-                    m_disposables.clear();
-                    return;
-                }
+                publish_disposed();
+                composite_dispose_impl(mode);
 
-                if (expected == State::Disposed)
-                    return;
+                m_disposables.dispose();
+                m_disposables.clear();
             }
         }
 
@@ -67,111 +65,167 @@ namespace rpp
             if (disposable.is_disposed() || disposable.lock().get() == this)
                 return;
 
-            while (true)
-            {
-                State expected{State::None};
-                // need to acquire possible disposables state changing from other `add`
-                if (m_current_state.compare_exchange_strong(expected, State::Edit, std::memory_order::seq_cst))
-                {
-                    try
-                    {
-                        m_disposables.push_back(std::move(disposable));
-                    }
-                    catch (...)
-                    {
-                        m_current_state.store(State::None, std::memory_order::seq_cst);
-                        throw;
-                    }
-                    // need to propogate disposables state changing to others
-                    m_current_state.store(State::None, std::memory_order::seq_cst);
-                    return;
-                }
-
-                if (expected == State::Disposed)
-                {
-                    disposable.dispose();
-                    return;
-                }
-            }
+            if (!m_state.edit([&] { m_disposables.push_back(std::move(disposable)); }))
+                disposable.dispose();
         }
 
         void remove(const disposable_wrapper& disposable) override
         {
-            while (true)
+            m_state.edit([&] { m_disposables.remove(disposable); });
+        }
+
+        void clear() override
+        {
+            m_state.edit([&] {
+                m_disposables.dispose();
+                m_disposables.clear();
+            });
+        }
+
+        /**
+         * @brief Same as `add`, but returns handle which can be used for O(1) removal via `remove(handle)`.
+         * @return handle or nullopt in case of disposable was not added (it is disposed, it is this or this is disposed)
+         */
+        template<details::disposables::constraint::handle_disposables_container TContainer = Container>
+        std::optional<typename TContainer::handle> add_with_handle(disposable_wrapper disposable)
+        {
+            if (disposable.is_disposed() || disposable.lock().get() == this)
+                return std::nullopt;
+
+            std::optional<typename TContainer::handle> result{};
+            if (!m_state.edit([&] { result = m_disposables.push_back(disposable); }))
+                disposable.dispose();
+            return result;
+        }
+
+        /**
+         * @brief Removes disposable added via `add_with_handle`.
+         * @return removed disposable or empty wrapper if it was removed before or this is disposed
+         */
+        template<details::disposables::constraint::handle_disposables_container TContainer = Container>
+        disposable_wrapper remove(const typename TContainer::handle& handle)
+        {
+            disposable_wrapper result = disposable_wrapper::empty();
+            m_state.edit([&] { result = m_disposables.remove(handle); });
+            return result;
+        }
+
+    protected:
+        virtual void composite_dispose_impl(interface_disposable::Mode) noexcept {}
+
+    private:
+        Container                             m_disposables{};
+        details::disposables::composite_state     m_state{};
+    };
+
+    /**
+     * @brief Disposable which can keep some other sub-disposables. When this root disposable is disposed, then all sub-disposables would be disposed too.
+     * @note By default uses vector as internal storage
+     *
+     * @ingroup disposables
+     */
+    class composite_disposable : public composite_disposable_impl<rpp::details::disposables::default_disposables_container>
+    {
+    };
+
+    /**
+     * @brief Same as @link rpp::composite_disposable_impl @endlink, but sub-disposables are spread over `ShardsCount` independent containers (by hash of disposable), so concurrent `add`/`remove` of different sub-disposables mostly don't contend with each other.
+     * @details Useful for very high fan-in, when a lot of threads add/remove sub-disposables at the same time. `clear` and `dispose` have to visit all shards.
+     * @tparam Container is type of internal storage used to keep dependencies of each shard
+     * @tparam ShardsCount is amount of independent containers
+     *
+     * @ingroup disposables
+     */
+    template<details::disposables::constraint::disposables_container Container, size_t ShardsCount>
+        requires (ShardsCount > 0)
+    class sharded_composite_disposable_impl : public interface_composite_disposable
+        , public details::disposed_flag_publisher
+    {
+    public:
+        sharded_composite_disposable_impl()                                                   = default;
+        sharded_composite_disposable_impl(const sharded_composite_disposable_impl&)           = delete;
+        sharded_composite_disposable_impl(sharded_composite_disposable_impl&& other) noexcept = delete;
+
+        bool is_disposed() const noexcept final
+        {
+            // need to acquire everything done before dispose
+            return m_disposed.load(std::memory_order::acquire);
+        }
+
+        void dispose_impl(interface_disposable::Mode) noexcept final
+        {
+            if (m_disposed.exchange(true, std::memory_order::acq_rel))
+                return;
+
+            publish_disposed();
+
+            // disposables added to not yet visited shards are disposed here too, later ones are rejected by disposed shard
+            for (auto& s : m_shards)
             {
-                State expected{State::None};
-                // need to acquire possible disposables state changing from other `add` or `remove`
-                if (m_current_state.compare_exchange_strong(expected, State::Edit, std::memory_order::seq_cst))
+                if (s.state.dispose())
                 {
-                    try
-                    {
-                        m_disposables.remove(disposable);
-                    }
-                    catch (...)
-                    {
-                        m_current_state.store(State::None, std::memory_order::seq_cst);
-                        throw;
-                    }
-                    // need to propogate disposables state changing to others
-                    m_current_state.store(State::None, std::memory_order::seq_cst);
-                    return;
+                    s.disposables.dispose();
+                    s.disposables.clear();
                 }
-
-                if (expected == State::Disposed)
-                    return;
             }
         }
 
+        using interface_composite_disposable::add;
+
+        void add(disposable_wrapper disposable) override
+        {
+            if (disposable.is_disposed() || disposable.lock().get() == this)
+                return;
+
+            auto& s = get_shard(disposable);
+            if (!s.state.edit([&] { s.disposables.push_back(std::move(disposable)); }))
+                disposable.dispose();
+        }
+
+        void remove(const disposable_wrapper& disposable) override
+        {
+            auto& s = get_shard(disposable);
+            s.state.edit([&] { s.disposables.remove(disposable); });
+        }
+
         void clear() override
         {
-            while (true)
+            for (auto& s : m_shards)
             {
-                State expected{State::None};
-                // need to acquire possible disposables state changing from other `add` or `remove`
-                if (m_current_state.compare_exchange_strong(expected, State::Edit, std::memory_order::seq_cst))
-                {
-                    try
-                    {
-                        m_disposables.dispose();
-                        m_disposables.clear();
-                    }
-                    catch (...)
-                    {
-                        m_current_state.store(State::None, std::memory_order::seq_cst);
-                        throw;
-                    }
-                    // need to propogate disposables state changing to others
-                    m_current_state.store(State::None, std::memory_order::seq_cst);
-                    return;
-                }
-
-                if (expected == State::Disposed)
-                    return;
+                s.state.edit([&] {
+                    s.disposables.dispose();
+                    s.disposables.clear();
+                });
             }
         }
 
-    protected:
-        virtual void composite_dispose_impl(interface_disposable::Mode) noexcept {}
-
     private:
-        enum class State : uint8_t
+        // each shard on own cache line to avoid false sharing between editors of different shards
+        struct alignas(64) shard
         {
-            None,    // default state
-            Edit,    // set it during adding new element into deps or removing. After success -> back to None
-            Disposed // permanent state after dispose
+            details::disposables::composite_state state{};
+            Container                             disposables{};
         };
 
-        Container          m_disposables{};
-        std::atomic<State> m_current_state{};
+        shard& get_shard(const disposable_wrapper& disposable)
+        {
+            // low bits of pointer are always zero due to alignment of allocation
+            return m_shards[(std::hash<disposable_wrapper>{}(disposable) / alignof(std::max_align_t)) % ShardsCount];
+        }
+
+    private:
+        std::array<shard, ShardsCount> m_shards{};
+        std::atomic_bool               m_disposed{};
     };
 
     /**
-     * @brief Disposable which can keep some other sub-disposables. When this root disposable is disposed, then all sub-disposables would be disposed too.
-     * @note By default uses vector as internal storage
+     * @brief Sharded version of @link rpp::composite_disposable @endlink for very high fan-in.
+     * @note By default uses vector as internal storage of each shard
      *
      * @ingroup disposables
      */
-    class composite_disposable : public composite_disposable_impl<rpp::details::disposables::default_disposables_container>
+    template<size_t ShardsCount>
+    class sharded_composite_disposable : public sharded_composite_disposable_impl<rpp::details::disposables::default_disposables_container, ShardsCount>
     {
     };
 } // namespace rpp
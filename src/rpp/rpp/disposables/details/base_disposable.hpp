@@ -12,6 +12,7 @@
 
 #include <rpp/disposables/fwd.hpp>
 
+#include <rpp/disposables/details/control_block.hpp>
 #include <rpp/disposables/interface_disposable.hpp>
 
 #include <atomic>
@@ -20,6 +21,7 @@ namespace rpp::details
 {
     template<typename BaseInterface>
     class base_disposable_impl : public BaseInterface
+        , public disposed_flag_publisher
     {
     public:
         base_disposable_impl()                                = default;
@@ -37,7 +39,10 @@ namespace rpp::details
         {
             // just need atomicity, not guarding anything
             if (m_disposed.exchange(true, std::memory_order::seq_cst) == false)
+            {
+                publish_disposed();
                 base_dispose_impl(mode);
+            }
         }
 
     protected:
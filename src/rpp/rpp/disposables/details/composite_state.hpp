@@ -0,0 +1,119 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/utils/utils.hpp>
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+namespace rpp::details::disposables
+{
+    /**
+     * @brief State of composite disposable guarding its container: exclusive "edit" lock plus permanent "disposed" state.
+     *
+     * @details Contended editor busy-spins bounded amount of iterations and then parks via `std::atomic::wait` (futex on Linux, WaitOnAddress on Windows). Releasing editor notifies only if somebody actually parked, so uncontended path is one CAS + one exchange.
+     */
+    class composite_state
+    {
+    public:
+        bool is_disposed() const noexcept
+        {
+            // need to acquire everything done before dispose
+            return m_state.load(std::memory_order::acquire) == State::Disposed;
+        }
+
+        /**
+         * @brief Applies `fn` under exclusive edit state
+         * @return false in case of state is disposed and `fn` was not invoked
+         */
+        template<std::invocable Fn>
+        bool edit(Fn&& fn)
+        {
+            if (!acquire(State::Edit))
+                return false;
+
+            try
+            {
+                fn();
+            }
+            catch (...)
+            {
+                release();
+                throw;
+            }
+            release();
+            return true;
+        }
+
+        /**
+         * @brief Moves state to permanent disposed state waiting for current editor (if any)
+         * @return true if this call is the one which has disposed state
+         */
+        bool dispose() noexcept
+        {
+            return acquire(State::Disposed);
+        }
+
+    private:
+        enum class State : uint32_t
+        {
+            None,          // default state
+            Edit,          // set it during editing of container. After success -> back to None
+            EditContended, // same as Edit, but some thread parked waiting for it
+            Disposed       // permanent state after dispose
+        };
+
+        static constexpr size_t s_spin_count = 64;
+
+        bool acquire(State target) noexcept
+        {
+            for (size_t i = 0;; ++i)
+            {
+                State expected{State::None};
+                // need to acquire container changes made by previous editor, `Disposed` also releases them to `is_disposed` readers
+                if (m_state.compare_exchange_weak(expected, target, std::memory_order::acq_rel, std::memory_order::relaxed))
+                    return true;
+
+                if (expected == State::Disposed)
+                    return false;
+
+                if (expected == State::None)
+                    continue;
+
+                if (i < s_spin_count)
+                {
+                    rpp::utils::cpu_relax();
+                    continue;
+                }
+
+                // announce that somebody is parked, so editor would notify on release
+                if (expected == State::Edit && !m_state.compare_exchange_weak(expected, State::EditContended, std::memory_order::relaxed, std::memory_order::relaxed))
+                    continue;
+
+                m_state.wait(State::EditContended, std::memory_order::relaxed);
+            }
+        }
+
+        void release() noexcept
+        {
+            // need to propagate container changes to next editor
+            if (m_state.exchange(State::None, std::memory_order::release) == State::EditContended)
+                m_state.notify_all();
+        }
+
+    private:
+        // 4-byte type to be waited via futex directly instead of proxy waiters table
+        std::atomic<State> m_state{};
+    };
+} // namespace rpp::details::disposables
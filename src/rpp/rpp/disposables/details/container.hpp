@@ -12,14 +12,37 @@
 #include <rpp/disposables/disposable_wrapper.hpp>
 #include <rpp/utils/exceptions.hpp>
 
-#include <algorithm>
+#include <cstdint>
+#include <limits>
 #include <vector>
 
 namespace rpp::details::disposables
 {
     class dynamic_disposables_container
     {
+        static constexpr uint32_t s_no_slot = std::numeric_limits<uint32_t>::max();
+
+        struct slot
+        {
+            rpp::disposable_wrapper disposable{};
+            uint32_t                generation{};
+            // index of next free slot or `s_no_slot` if slot is occupied/last free one
+            uint32_t next_free{s_no_slot};
+            bool     occupied{};
+        };
+
     public:
+        /**
+         * @brief Stable reference to disposable added via `push_back`. Stays valid till disposable is removed or container is cleared, reused slots are never matched by stale handle.
+         */
+        struct handle
+        {
+            uint32_t index{};
+            uint32_t generation{};
+
+            bool operator==(const handle&) const = default;
+        };
+
         explicit dynamic_disposables_container() = default;
 
         dynamic_disposables_container(const dynamic_disposables_container&)           = delete;
@@ -28,36 +51,93 @@ namespace rpp::details::disposables
         dynamic_disposables_container& operator=(const dynamic_disposables_container& other)     = delete;
         dynamic_disposables_container& operator=(dynamic_disposables_container&& other) noexcept = default;
 
-        void push_back(const rpp::disposable_wrapper& d)
+        handle push_back(const rpp::disposable_wrapper& d)
         {
-            m_data.push_back(d);
+            return emplace(rpp::disposable_wrapper{d});
         }
 
-        void push_back(rpp::disposable_wrapper&& d)
+        handle push_back(rpp::disposable_wrapper&& d)
         {
-            m_data.push_back(std::move(d));
+            return emplace(std::move(d));
+        }
+
+        /**
+         * @brief Removes disposable by handle obtained from `push_back` in O(1)
+         * @return removed disposable or empty wrapper if handle is stale
+         */
+        rpp::disposable_wrapper remove(const handle& h)
+        {
+            if (h.index >= m_data.size())
+                return rpp::disposable_wrapper::empty();
+
+            auto& s = m_data[h.index];
+            if (!s.occupied || s.generation != h.generation)
+                return rpp::disposable_wrapper::empty();
+
+            auto result = std::move(s.disposable);
+            release(h.index);
+            return result;
         }
 
         void remove(const rpp::disposable_wrapper& d)
         {
-            m_data.erase(std::remove(m_data.begin(), m_data.end(), d), m_data.end());
+            for (uint32_t i = 0; i < m_data.size(); ++i)
+            {
+                if (m_data[i].occupied && m_data[i].disposable == d)
+                    release(i);
+            }
         }
 
         void dispose() const
         {
-            for (const auto& d : m_data)
+            for (const auto& s : m_data)
             {
-                d.dispose();
+                if (s.occupied)
+                    s.disposable.dispose();
             }
         }
 
         void clear()
         {
-            m_data.clear();
+            // slots are kept to never match stale handles
+            for (uint32_t i = 0; i < m_data.size(); ++i)
+            {
+                if (m_data[i].occupied)
+                    release(i);
+            }
         }
 
     private:
-        mutable std::vector<rpp::disposable_wrapper> m_data{};
+        handle emplace(rpp::disposable_wrapper&& d)
+        {
+            if (m_free_head == s_no_slot)
+            {
+                m_data.push_back(slot{.disposable = std::move(d), .occupied = true});
+                return handle{static_cast<uint32_t>(m_data.size() - 1), 0};
+            }
+
+            const auto index = m_free_head;
+            auto&      s     = m_data[index];
+            m_free_head      = s.next_free;
+            s.disposable     = std::move(d);
+            s.next_free      = s_no_slot;
+            s.occupied       = true;
+            return handle{index, s.generation};
+        }
+
+        void release(uint32_t index)
+        {
+            auto& s = m_data[index];
+            s.disposable = rpp::disposable_wrapper::empty();
+            s.occupied  = false;
+            ++s.generation;
+            s.next_free = m_free_head;
+            m_free_head = index;
+        }
+
+    private:
+        mutable std::vector<slot> m_data{};
+        uint32_t                  m_free_head{s_no_slot};
     };
 
     template<size_t Count>
@@ -137,6 +217,8 @@ namespace rpp::details::disposables
             m_size = 0;
         }
 
+        size_t size() const { return m_size; }
+
     private:
         const rpp::disposable_wrapper* get(size_t i) const
         {
@@ -165,4 +247,59 @@ namespace rpp::details::disposables
         static void dispose() {}
         static void clear() {}
     };
+
+    template<size_t InlineCount>
+        requires (InlineCount > 0)
+    class small_dynamic_disposables_container
+    {
+    public:
+        small_dynamic_disposables_container()                                                             = default;
+        small_dynamic_disposables_container(const small_dynamic_disposables_container&)                  = delete;
+        small_dynamic_disposables_container& operator=(const small_dynamic_disposables_container& other) = delete;
+
+        small_dynamic_disposables_container(small_dynamic_disposables_container&& other) noexcept            = default;
+        small_dynamic_disposables_container& operator=(small_dynamic_disposables_container&& other) noexcept = default;
+
+        void push_back(const rpp::disposable_wrapper& d)
+        {
+            if (m_inline.size() < InlineCount)
+                m_inline.push_back(d);
+            else
+                m_spilled.push_back(d);
+        }
+
+        void push_back(rpp::disposable_wrapper&& d)
+        {
+            if (m_inline.size() < InlineCount)
+                m_inline.push_back(std::move(d));
+            else
+                m_spilled.push_back(std::move(d));
+        }
+
+        void remove(const rpp::disposable_wrapper& d)
+        {
+            m_inline.remove(d);
+            std::erase(m_spilled, d);
+        }
+
+        void dispose() const
+        {
+            m_inline.dispose();
+            for (const auto& d : m_spilled)
+            {
+                d.dispose();
+            }
+        }
+
+        void clear()
+        {
+            m_inline.clear();
+            m_spilled.clear();
+        }
+
+    private:
+        static_disposables_container<InlineCount> m_inline{};
+        // default constructed vector doesn't allocate, so heap is touched only after `InlineCount` disposables
+        std::vector<rpp::disposable_wrapper> m_spilled{};
+    };
 } // namespace rpp::details::disposables
@@ -0,0 +1,266 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/disposables/fwd.hpp>
+
+#include <rpp/disposables/details/subscription_arena.hpp>
+#include <rpp/disposables/interface_disposable.hpp>
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace rpp::details
+{
+    /**
+     * @brief Intrusive strong/weak reference counters of disposable created via `disposable_wrapper_impl::make`. Disposable itself is placed right after counters, so only one allocation is used per disposable.
+     *
+     * @details Strong references keep disposable alive, weak references keep only this block alive. When last strong reference is released, disposable is disposed in `Destroying` mode and destroyed immediately. Block itself is deallocated when last weak reference is released (all strong references together hold one weak reference).
+     *
+     * Block also keeps own copy of disposed flag: it is set as soon as disposable becomes expired and, for disposables derived from `disposed_flag_publisher`, as soon as disposable is disposed. As a result weak reference can check `is_disposed` without keeping disposable alive.
+     */
+    class disposable_control_block
+    {
+    public:
+        disposable_control_block(const disposable_control_block&) = delete;
+        disposable_control_block(disposable_control_block&&)      = delete;
+
+        // blocks created while subscribing through operator chain share one chunk of memory
+        static void* operator new(size_t size) { return disposables::subscription_arena::allocate(size); }
+        static void  operator delete(void* ptr) noexcept { disposables::subscription_arena::deallocate(ptr); }
+
+        // over-aligned disposables are never placed into shared chunk
+        static void* operator new(size_t size, std::align_val_t alignment) { return ::operator new(size, alignment); }
+        static void  operator delete(void* ptr, std::align_val_t alignment) noexcept { ::operator delete(ptr, alignment); }
+
+        void add_strong() noexcept { m_strong.fetch_add(1, std::memory_order::relaxed); }
+
+        bool try_add_strong() noexcept
+        {
+            auto current = m_strong.load(std::memory_order::relaxed);
+            while (current != 0)
+            {
+                // need to acquire everything done with disposable before it was shared
+                if (m_strong.compare_exchange_weak(current, current + 1, std::memory_order::acquire, std::memory_order::relaxed))
+                    return true;
+            }
+            return false;
+        }
+
+        void release_strong() noexcept
+        {
+            if (m_strong.fetch_sub(1, std::memory_order::acq_rel) != 1)
+                return;
+
+            mark_disposed();
+            destroy_disposable();
+            release_weak();
+        }
+
+        void add_weak() noexcept { m_weak.fetch_add(1, std::memory_order::relaxed); }
+
+        void release_weak() noexcept
+        {
+            if (m_weak.fetch_sub(1, std::memory_order::acq_rel) == 1)
+                delete this;
+        }
+
+        size_t use_count() const noexcept { return m_strong.load(std::memory_order::relaxed); }
+
+        /**
+         * @brief Raw pointer to disposable. Safe to dereference only while strong reference is held.
+         */
+        interface_disposable* get() const noexcept { return m_disposable; }
+
+        /**
+         * @brief Checks if disposable is disposed while holding only weak reference.
+         * @details Reads only own disposed flag of the block if disposable publishes it, otherwise disposable is kept alive during check.
+         */
+        bool is_disposed_weak() noexcept
+        {
+            // just need atomicity, not guarding anything
+            if (m_disposed.load(std::memory_order::seq_cst))
+                return true;
+
+            if (m_is_disposed_published)
+                return false;
+
+            if (!try_add_strong())
+                return true;
+
+            const auto result = m_disposable->is_disposed();
+            release_strong();
+            return result;
+        }
+
+        void mark_disposed() noexcept
+        {
+            // just need atomicity, not guarding anything
+            m_disposed.store(true, std::memory_order::seq_cst);
+        }
+
+    protected:
+        explicit disposable_control_block(bool is_disposed_published)
+            : m_is_disposed_published{is_disposed_published}
+        {
+        }
+
+        virtual ~disposable_control_block() noexcept = default;
+
+        void set_disposable(interface_disposable* disposable) noexcept { m_disposable = disposable; }
+
+        virtual void destroy_disposable() noexcept = 0;
+
+    private:
+        std::atomic<size_t>   m_strong{1};
+        std::atomic<size_t>   m_weak{1};
+        interface_disposable* m_disposable{};
+        std::atomic_bool      m_disposed{};
+        const bool            m_is_disposed_published;
+    };
+
+    /**
+     * @brief Mixin for disposables which are able to report own disposing to the `disposable_control_block` they are placed in.
+     */
+    class disposed_flag_publisher
+    {
+        template<rpp::constraint::decayed_type TDisposable>
+        friend class auto_dispose_wrapper;
+
+    protected:
+        disposed_flag_publisher() = default;
+
+        void publish_disposed() const noexcept
+        {
+            if (m_block)
+                m_block->mark_disposed();
+        }
+
+    private:
+        disposable_control_block* m_block{};
+    };
+
+    /**
+     * @brief Strong reference to disposable created via `disposable_wrapper_impl::make` (or to any part of it). Same as `std::shared_ptr`, but over intrusive `disposable_control_block`.
+     */
+    template<typename T>
+    class disposable_ptr
+    {
+    public:
+        template<typename U>
+        friend class disposable_ptr;
+
+        template<rpp::constraint::decayed_type TDisposable>
+        friend class rpp::disposable_wrapper_impl;
+
+        template<rpp::constraint::decayed_type TDisposable>
+        friend class enable_wrapper_from_this;
+
+        disposable_ptr() = default;
+
+        disposable_ptr(std::nullptr_t) noexcept {}
+
+        /**
+         * @brief Aliasing constructor: shares ownership with `owner`, but points to `ptr`
+         */
+        template<typename U>
+        disposable_ptr(const disposable_ptr<U>& owner, T* ptr) noexcept
+            : m_ptr{ptr}
+            , m_block{owner.m_block}
+        {
+            if (m_block)
+                m_block->add_strong();
+        }
+
+        disposable_ptr(const disposable_ptr& other) noexcept
+            : disposable_ptr{other, other.m_ptr}
+        {
+        }
+
+        disposable_ptr(disposable_ptr&& other) noexcept
+            : m_ptr{std::exchange(other.m_ptr, nullptr)}
+            , m_block{std::exchange(other.m_block, nullptr)}
+        {
+        }
+
+        template<typename U>
+            requires std::convertible_to<U*, T*>
+        disposable_ptr(const disposable_ptr<U>& other) noexcept
+            : disposable_ptr{other, other.m_ptr}
+        {
+        }
+
+        template<typename U>
+            requires std::convertible_to<U*, T*>
+        disposable_ptr(disposable_ptr<U>&& other) noexcept
+            : m_ptr{std::exchange(other.m_ptr, nullptr)}
+            , m_block{std::exchange(other.m_block, nullptr)}
+        {
+        }
+
+        disposable_ptr& operator=(const disposable_ptr& other) noexcept
+        {
+            disposable_ptr{other}.swap(*this);
+            return *this;
+        }
+
+        disposable_ptr& operator=(disposable_ptr&& other) noexcept
+        {
+            disposable_ptr{std::move(other)}.swap(*this);
+            return *this;
+        }
+
+        ~disposable_ptr() noexcept
+        {
+            if (m_block)
+                m_block->release_strong();
+        }
+
+        void swap(disposable_ptr& other) noexcept
+        {
+            std::swap(m_ptr, other.m_ptr);
+            std::swap(m_block, other.m_block);
+        }
+
+        void reset() noexcept { disposable_ptr{}.swap(*this); }
+
+        T* get() const noexcept { return m_ptr; }
+        T* operator->() const noexcept { return m_ptr; }
+        T& operator*() const noexcept { return *m_ptr; }
+
+        explicit operator bool() const noexcept { return m_ptr != nullptr; }
+
+        size_t use_count() const noexcept { return m_block ? m_block->use_count() : 0; }
+
+        bool operator==(std::nullptr_t) const noexcept { return m_ptr == nullptr; }
+
+        template<typename U>
+        bool operator==(const disposable_ptr<U>& other) const noexcept
+        {
+            return m_ptr == other.m_ptr;
+        }
+
+    private:
+        // adopts already acquired strong reference
+        disposable_ptr(T* ptr, disposable_control_block* block) noexcept
+            : m_ptr{ptr}
+            , m_block{block}
+        {
+        }
+
+    private:
+        T*                        m_ptr{};
+        disposable_control_block* m_block{};
+    };
+} // namespace rpp::details
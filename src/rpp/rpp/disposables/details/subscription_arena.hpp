@@ -0,0 +1,183 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace rpp::details::disposables
+{
+    /**
+     * @brief Single chunk of memory shared by disposables created while subscribing through one operator chain.
+     *
+     * @details Operator chain opens `subscription_arena::scope` for the time of lifting observers through its operators. First disposable created inside scope is allocated as usual (most of chains have only one stateful operator), next ones are bump-allocated inside one shared chunk, so whole subscription state is placed close to each other and costs one extra allocation at most. Each placed disposable keeps own refcount as before, chunk itself is freed when last of them is destroyed.
+     *
+     * Every allocation is prefixed with header keeping owning arena (or nullptr for plain heap allocation), so deallocation doesn't need to know where memory came from.
+     */
+    class subscription_arena
+    {
+        static constexpr size_t s_header_size  = alignof(std::max_align_t);
+        static constexpr size_t s_min_capacity = 512;
+
+        struct thread_state
+        {
+            bool                active{};
+            bool                has_first_allocation{};
+            subscription_arena* arena{};
+        };
+
+        static thread_state& get_thread_state() noexcept
+        {
+            static thread_local thread_state s_state{};
+            return s_state;
+        }
+
+    public:
+        /**
+         * @brief Places disposables created by current thread till end of scope into shared chunk. Nested scopes are no-op.
+         */
+        class scope
+        {
+        public:
+            scope() noexcept
+                : m_is_owner{!get_thread_state().active}
+            {
+                if (m_is_owner)
+                    get_thread_state() = thread_state{.active = true};
+            }
+
+            scope(const scope&) = delete;
+            scope(scope&&)      = delete;
+
+            ~scope() noexcept
+            {
+                if (!m_is_owner)
+                    return;
+
+                auto& state = get_thread_state();
+                if (state.arena)
+                    state.arena->release();
+                state = thread_state{};
+            }
+
+        private:
+            bool m_is_owner;
+        };
+
+        /**
+         * @brief Temporarily disables active scope. Used around subscription to the source: state created there (for example, inner subscriptions of emissions) has independent lifetime and shouldn't keep chunk alive.
+         */
+        class suspend_scope
+        {
+        public:
+            suspend_scope() noexcept
+                : m_saved{std::exchange(get_thread_state(), thread_state{})}
+            {
+            }
+
+            suspend_scope(const suspend_scope&) = delete;
+            suspend_scope(suspend_scope&&)      = delete;
+
+            ~suspend_scope() noexcept
+            {
+                get_thread_state() = m_saved;
+            }
+
+        private:
+            thread_state m_saved;
+        };
+
+        static void* allocate(size_t size)
+        {
+            auto& state = get_thread_state();
+            if (state.active)
+            {
+                if (!state.has_first_allocation)
+                    state.has_first_allocation = true;
+                else
+                {
+                    if (!state.arena)
+                        state.arena = create(std::max(s_min_capacity, 4 * (align(size) + s_header_size)));
+
+                    if (void* ptr = state.arena->try_allocate(size))
+                        return ptr;
+                }
+            }
+
+            return with_header(::operator new(size + s_header_size), nullptr);
+        }
+
+        static void deallocate(void* ptr) noexcept
+        {
+            if (!ptr)
+                return;
+
+            auto* header = static_cast<std::byte*>(ptr) - s_header_size;
+            if (auto* arena = *std::launder(reinterpret_cast<subscription_arena**>(header)))
+                arena->release();
+            else
+                ::operator delete(header);
+        }
+
+    private:
+        explicit subscription_arena(size_t capacity) noexcept
+            : m_capacity{capacity}
+        {
+        }
+
+        static size_t align(size_t size) noexcept { return (size + s_header_size - 1) / s_header_size * s_header_size; }
+
+        static void* with_header(void* memory, subscription_arena* owner) noexcept
+        {
+            ::new (memory) subscription_arena*{owner};
+            return static_cast<std::byte*>(memory) + s_header_size;
+        }
+
+        static subscription_arena* create(size_t capacity)
+        {
+            static_assert(sizeof(subscription_arena) % s_header_size == 0);
+            return ::new (::operator new(sizeof(subscription_arena) + capacity)) subscription_arena{capacity};
+        }
+
+        std::byte* data() noexcept { return reinterpret_cast<std::byte*>(this) + sizeof(subscription_arena); }
+
+        void* try_allocate(size_t size) noexcept
+        {
+            const auto required = align(size) + s_header_size;
+            if (m_capacity - m_used < required)
+                return nullptr;
+
+            auto* memory = data() + m_used;
+            m_used += required;
+            // scope keeps own reference while allocating, so counter can't reach zero concurrently
+            m_refcount.fetch_add(1, std::memory_order::relaxed);
+            return with_header(memory, this);
+        }
+
+        void release() noexcept
+        {
+            if (m_refcount.fetch_sub(1, std::memory_order::acq_rel) == 1)
+            {
+                std::destroy_at(this);
+                ::operator delete(this);
+            }
+        }
+
+    private:
+        alignas(std::max_align_t) std::atomic<size_t> m_refcount{1};
+        size_t m_capacity;
+        size_t m_used{};
+    };
+} // namespace rpp::details::disposables
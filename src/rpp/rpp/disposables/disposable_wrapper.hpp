@@ -13,11 +13,14 @@
 #include <rpp/disposables/fwd.hpp>
 
 #include <rpp/defs.hpp>
+#include <rpp/disposables/details/control_block.hpp>
 #include <rpp/disposables/interface_disposable.hpp>
 #include <rpp/utils/utils.hpp>
 
+#include <cstdint>
+#include <functional>
 #include <memory>
-#include <variant>
+#include <utility>
 
 namespace rpp::details
 {
@@ -25,7 +28,7 @@ namespace rpp::details
     class enable_wrapper_from_this;
 
     template<rpp::constraint::decayed_type TDisposable>
-    class auto_dispose_wrapper final
+    class auto_dispose_wrapper final : public disposable_control_block
     {
     public:
         static_assert(std::derived_from<TDisposable, interface_disposable>);
@@ -33,71 +36,159 @@ namespace rpp::details
         template<typename... TArgs>
             requires (std::constructible_from<TDisposable, TArgs && ...> && !rpp::constraint::variadic_decayed_same_as<auto_dispose_wrapper, TArgs...>)
         explicit auto_dispose_wrapper(TArgs&&... args)
-            : m_data{std::forward<TArgs>(args)...}
+            : disposable_control_block{std::derived_from<TDisposable, disposed_flag_publisher>}
+            , m_data{std::forward<TArgs>(args)...}
         {
+            set_disposable(&m_data);
+            if constexpr (std::derived_from<TDisposable, disposed_flag_publisher>)
+                static_cast<disposed_flag_publisher&>(m_data).m_block = this;
         }
 
         auto_dispose_wrapper(const auto_dispose_wrapper&)     = delete;
         auto_dispose_wrapper(auto_dispose_wrapper&&) noexcept = delete;
 
-        ~auto_dispose_wrapper() noexcept
+        // disposable is destroyed earlier in `destroy_disposable` when last strong reference is released
+        ~auto_dispose_wrapper() noexcept override {}
+
+        TDisposable* get() { return &m_data; }
+
+    private:
+        void destroy_disposable() noexcept override
         {
             static_cast<interface_disposable&>(m_data).dispose_impl(rpp::interface_disposable::Mode::Destroying);
+            std::destroy_at(&m_data);
         }
 
-        TDisposable* get() { return &m_data; }
-
     private:
-        RPP_NO_UNIQUE_ADDRESS TDisposable m_data;
+        union
+        {
+            TDisposable m_data;
+        };
     };
 
     class disposable_wrapper_base
     {
     public:
+        disposable_wrapper_base(const disposable_wrapper_base& other) noexcept
+            : m_data{other.m_data}
+        {
+            add_reference();
+        }
+
+        disposable_wrapper_base(disposable_wrapper_base&& other) noexcept
+            : m_data{std::exchange(other.m_data, s_empty)}
+        {
+        }
+
+        disposable_wrapper_base& operator=(const disposable_wrapper_base& other) noexcept
+        {
+            if (this != &other)
+                *this = disposable_wrapper_base{other};
+            return *this;
+        }
+
+        disposable_wrapper_base& operator=(disposable_wrapper_base&& other) noexcept
+        {
+            if (this != &other)
+            {
+                release();
+                m_data = std::exchange(other.m_data, s_empty);
+            }
+            return *this;
+        }
+
+        ~disposable_wrapper_base() noexcept
+        {
+            release();
+        }
+
         bool operator==(const disposable_wrapper_base& other) const
         {
-            return get().first == other.get().first;
+            return get_block() == other.get_block();
         }
 
         bool is_disposed() const noexcept
         {
-            if (const auto locked = get().first)
-                return locked->is_disposed();
-            return true;
+            if (!is_weak())
+                return get_block()->get()->is_disposed();
+
+            const auto block = get_block();
+            return !block || block->is_disposed_weak();
         }
 
         void dispose() const noexcept
         {
-            if (const auto locked = get().first)
-                locked->dispose();
+            const auto block = get_block();
+            if (!is_weak())
+            {
+                block->get()->dispose();
+            }
+            else if (block && block->try_add_strong())
+            {
+                block->get()->dispose();
+                block->release_strong();
+            }
         }
 
     protected:
-        explicit disposable_wrapper_base(std::shared_ptr<interface_disposable>&& disposable)
-            : m_disposable{std::move(disposable)}
-        {
-        }
-
-        explicit disposable_wrapper_base(std::weak_ptr<interface_disposable>&& disposable)
-            : m_disposable{std::move(disposable)}
+        // adopts already acquired reference of provided kind
+        disposable_wrapper_base(disposable_control_block* block, bool is_weak) noexcept
+            : m_data{reinterpret_cast<std::uintptr_t>(block) | (is_weak || !block ? s_weak_tag : 0)}
         {
         }
 
         disposable_wrapper_base() = default;
 
-        std::pair<std::shared_ptr<interface_disposable>, bool> get() const noexcept
+        disposable_control_block* get_block() const noexcept { return reinterpret_cast<disposable_control_block*>(m_data & ~s_weak_tag); }
+
+        bool is_weak() const noexcept { return m_data & s_weak_tag; }
+
+        /**
+         * @brief Acquires one more reference of the same kind as this wrapper has
+         */
+        disposable_control_block* add_reference() const noexcept
         {
-            if (const auto ptr_ptr = std::get_if<std::shared_ptr<interface_disposable>>(&m_disposable))
-                return {*ptr_ptr, true};
+            const auto block = get_block();
+            if (!is_weak())
+                block->add_strong();
+            else if (block)
+                block->add_weak();
+            return block;
+        }
 
-            if (const auto ptr_ptr = std::get_if<std::weak_ptr<interface_disposable>>(&m_disposable))
-                return {ptr_ptr->lock(), false};
+        /**
+         * @brief Acquires strong reference to disposable if it is still alive
+         */
+        disposable_control_block* acquire_strong() const noexcept
+        {
+            const auto block = get_block();
+            if (!is_weak())
+            {
+                block->add_strong();
+                return block;
+            }
+            return block && block->try_add_strong() ? block : nullptr;
+        }
 
-            return {nullptr, true};
+    private:
+        void release() noexcept
+        {
+            const auto block = get_block();
+            if (!is_weak())
+                block->release_strong();
+            else if (block)
+                block->release_weak();
+            m_data = s_empty;
         }
 
     private:
-        std::variant<std::monostate, std::shared_ptr<interface_disposable>, std::weak_ptr<interface_disposable>> m_disposable;
+        static constexpr std::uintptr_t s_weak_tag = 1;
+        // empty wrapper is kept as weak one, so strong wrapper always points to alive disposable
+        static constexpr std::uintptr_t s_empty = s_weak_tag;
+        static_assert(alignof(disposable_control_block) > s_weak_tag);
+
+        // pointer to control block with lowest bit used as "weak" tag
+        std::uintptr_t m_data{s_empty};
     };
 
 } // namespace rpp::details
@@ -111,8 +202,9 @@ namespace rpp
      * - disposable_wrapper shares ownership like std::shared_ptr
      * - any disposable created via disposable_wrapper would have call `dispose()` during it's destruction (during destruction of last disposable_wrapper owning it)
      * - disposable_wrapper's methods is safe to use over empty/gone/disposed/weak disposables.
-     * - as soon as disposable can be actually "any internal state" it provides access to "raw" shared_ptr and it can be nullptr in case of disposable empty/ptr gone.
+     * - as soon as disposable can be actually "any internal state" it provides access to "raw" pointer via `lock()` (shared_ptr-like strong reference) and it can be nullptr in case of disposable empty/ptr gone.
      * - disposable_wrapper can be strong or weak (same as std::shared_ptr). weak disposable is important, for example, when it keeps observer and this observer should keep this disposable at the same time.
+     * - disposable_wrapper is just one pointer to intrusive control block placed in the same allocation as disposable itself. `is_disposed()` over weak disposable_wrapper doesn't touch reference counters for built-in disposables.
      * - disposable_wrapper has popluar methods to work with disposable: `dispose()`, `is_disposed()` and `add()`/`remove()`/`clear()` (for `interface_composite_disposable`).
      *
      * To construct wrapper you have to use `make` method:
@@ -149,6 +241,8 @@ namespace rpp
         template<rpp::constraint::decayed_type TTarget>
         friend class details::enable_wrapper_from_this;
 
+        friend struct std::hash<disposable_wrapper_impl>;
+
         bool operator==(const disposable_wrapper_impl&) const = default;
 
         /**
@@ -163,13 +257,12 @@ namespace rpp
             requires (std::constructible_from<TTarget, TArgs && ...>)
         [[nodiscard]] static disposable_wrapper_impl make(TArgs&&... args)
         {
-            const auto ptr      = std::make_shared<details::auto_dispose_wrapper<TTarget>>(std::forward<TArgs>(args)...);
-            auto       base_ptr = std::shared_ptr<TDisposable>{ptr, static_cast<TDisposable*>(ptr->get())};
-            if constexpr (rpp::utils::is_base_of_v<TDisposable, rpp::details::enable_wrapper_from_this>)
+            const auto block = new details::auto_dispose_wrapper<TTarget>(std::forward<TArgs>(args)...);
+            if constexpr (rpp::utils::is_base_of_v<TTarget, rpp::details::enable_wrapper_from_this>)
             {
-                base_ptr->set_weak_self(std::weak_ptr<interface_disposable>(base_ptr));
+                block->get()->set_control_block(block);
             }
-            return disposable_wrapper_impl{std::static_pointer_cast<interface_disposable>(std::move(base_ptr))};
+            return disposable_wrapper_impl{block, false};
         }
 
         /**
@@ -212,32 +305,29 @@ namespace rpp
                 locked->clear();
         }
 
-        [[nodiscard]] std::shared_ptr<TDisposable> lock() const noexcept
+        [[nodiscard]] details::disposable_ptr<TDisposable> lock() const noexcept
         {
-            return std::static_pointer_cast<TDisposable>(get().first);
+            if (const auto block = acquire_strong())
+                return details::disposable_ptr<TDisposable>{static_cast<TDisposable*>(block->get()), block};
+            return {};
         }
 
         [[nodiscard]] disposable_wrapper_impl as_weak() const
         {
-            auto [locked, is_shared] = get();
-            if (is_shared)
-                return disposable_wrapper_impl{std::weak_ptr<interface_disposable>{locked}};
-            return *this;
+            if (is_weak())
+                return *this;
+
+            const auto block = get_block();
+            block->add_weak();
+            return disposable_wrapper_impl{block, true};
         }
 
         template<constraint::decayed_type TTarget>
             requires rpp::constraint::static_pointer_convertible_to<TDisposable, TTarget>
         operator disposable_wrapper_impl<TTarget>() const
         {
-            auto [locked, is_shared] = get();
-            if (!locked)
-                return rpp::disposable_wrapper_impl<TTarget>::empty();
-
-            auto res = disposable_wrapper_impl<TTarget>{std::move(locked)};
-            if (is_shared)
-                return res;
-
-            return res.as_weak();
+            const auto block = add_reference();
+            return disposable_wrapper_impl<TTarget>{block, is_weak()};
         }
 
     private:
@@ -257,18 +347,45 @@ namespace rpp::details
     protected:
         enable_wrapper_from_this() = default;
 
-        void set_weak_self(std::weak_ptr<interface_disposable> weak)
+        void set_control_block(disposable_control_block* block)
         {
-            m_weak = std::move(weak);
+            m_block = block;
         }
 
     public:
         disposable_wrapper_impl<TStrategy> wrapper_from_this() const
         {
-            return disposable_wrapper_impl<TStrategy>(std::static_pointer_cast<interface_disposable>(m_weak.lock()));
+            if (m_block && m_block->try_add_strong())
+                return disposable_wrapper_impl<TStrategy>{m_block, false};
+            return disposable_wrapper_impl<TStrategy>::empty();
+        }
+
+    protected:
+        /**
+         * @brief Strong pointer to this disposable. Unlike `wrapper_from_this` doesn't wrap it into `disposable_wrapper_impl`.
+         * @details Empty if there are no strong references to this disposable anymore (for example, it is being destroyed). Never empty if invoked via some strong reference.
+         */
+        disposable_ptr<TStrategy> ptr_from_this() const noexcept
+        {
+            if (m_block && m_block->try_add_strong())
+                return disposable_ptr<TStrategy>{static_cast<TStrategy*>(m_block->get()), m_block};
+            return {};
         }
 
     private:
-        std::weak_ptr<interface_disposable> m_weak{};
+        // control block containing this disposable, so it is alive while disposable is alive
+        disposable_control_block* m_block{};
     };
 } // namespace rpp::details
+
+/**
+ * @brief Hash of disposable_wrapper consistent with its `operator==`: strong and weak wrappers of the same disposable have the same hash.
+ */
+template<rpp::constraint::decayed_type TDisposable>
+struct std::hash<rpp::disposable_wrapper_impl<TDisposable>>
+{
+    size_t operator()(const rpp::disposable_wrapper_impl<TDisposable>& d) const noexcept
+    {
+        return std::hash<const void*>{}(d.get_block());
+    }
+};
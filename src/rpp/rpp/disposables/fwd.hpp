@@ -51,10 +51,19 @@ namespace rpp::details::disposables
             const_c.dispose();
             c.clear();
         };
+
+        /**
+         * @brief Container which provides stable handles for O(1) removal of added disposables
+         */
+        template<typename T>
+        concept handle_disposables_container = disposables_container<T> && requires(T& c, const rpp::disposable_wrapper& d, const typename T::handle& h) {
+            { c.push_back(d) } -> std::same_as<typename T::handle>;
+            { c.remove(h) } -> std::same_as<rpp::disposable_wrapper>;
+        };
     } // namespace constraint
 
     /**
-     * @brief Container with std::vector as underlying storage.
+     * @brief Container with std::vector of slots as underlying storage. Provides handles for O(1) removal, storage of removed disposables is reused.
      */
     class dynamic_disposables_container;
 
@@ -64,6 +73,18 @@ namespace rpp::details::disposables
     template<size_t Count>
     class static_disposables_container;
 
+    /**
+     * @brief Container keeping first `InlineCount` disposables inline (same as static_disposables_container) and spilling the rest to std::vector.
+     */
+    template<size_t InlineCount>
+        requires (InlineCount > 0)
+    class small_dynamic_disposables_container;
+
+    /**
+     * @brief Container used by type-erased chains: most of subscriptions keep 1-3 upstream disposables, so they fit inline without any allocation.
+     */
+    using small_disposables_container = small_dynamic_disposables_container<3>;
+
     using default_disposables_container = dynamic_disposables_container;
 } // namespace rpp::details::disposables
 
@@ -71,6 +92,9 @@ namespace rpp
 {
     class composite_disposable;
 
+    template<size_t ShardsCount = 16>
+    class sharded_composite_disposable;
+
     template<rpp::constraint::is_nothrow_invocable Fn>
     class callback_disposable;
 
@@ -17,6 +17,7 @@
 #include <rpp/disposables/disposable_wrapper.hpp>
 
 #include <atomic>
+#include <cstdint>
 #include <limits>
 
 namespace rpp::details
@@ -64,27 +65,44 @@ namespace rpp
 
 namespace rpp::details
 {
-    class refocunt_disposable_inner final : public rpp::composite_disposable
-        , public rpp::details::enable_wrapper_from_this<refocunt_disposable_inner>
+    /**
+     * @brief Reference token returned by `refcount_disposable::add_ref`. Releases its reference to parent exactly once: on first dispose or on destruction.
+     *
+     * @details Token is registered in parent by handle, so it is removed from parent in O(1) and doesn't leave stale entries in parent even if it was destroyed without disposing. Own sub-disposables are kept inline (usually token has at most one upstream).
+     */
+    class refocunt_disposable_inner final : public rpp::composite_disposable_impl<rpp::details::disposables::small_dynamic_disposables_container<1>>
     {
     public:
-        refocunt_disposable_inner(disposable_wrapper_impl<refcount_disposable> state)
+        using handle = rpp::details::disposables::dynamic_disposables_container::handle;
+
+        explicit refocunt_disposable_inner(disposable_ptr<refcount_disposable> state)
             : m_state{std::move(state)}
         {
         }
 
-        void composite_dispose_impl(interface_disposable::Mode mode) noexcept override
+        void set_handle(handle h) noexcept
+        {
+            // parent can dispose this token concurrently right after it was registered: handle is stored before caller checks `is_disposed()`, while dispose marks token disposed before loading handle.
+            // Fences on both sides guarantee that at least one of them sees the other one's store, so handle is always removed from parent
+            m_handle.store(h, std::memory_order::seq_cst);
+            std::atomic_thread_fence(std::memory_order::seq_cst);
+        }
+
+        void composite_dispose_impl(interface_disposable::Mode) noexcept override
         {
-            if (mode != interface_disposable::Mode::Destroying)
-                m_state.remove(this->wrapper_from_this());
+            // invoked exactly once by composite_disposable_impl, so `m_state` is not shared with anyone else
+            const auto state = std::move(m_state);
 
-            if (const auto locked = m_state.lock())
-                locked->release();
-            m_state = disposable_wrapper_impl<refcount_disposable>::empty();
+            // pairs with fence in `set_handle`
+            std::atomic_thread_fence(std::memory_order::seq_cst);
+            state->remove(m_handle.load(std::memory_order::seq_cst));
+            state->release();
         }
 
     private:
-        disposable_wrapper_impl<refcount_disposable> m_state;
+        disposable_ptr<refcount_disposable> m_state;
+        // default value is never matched by parent's container, so disposing before registration is no-op for parent
+        std::atomic<handle> m_handle{handle{std::numeric_limits<uint32_t>::max(), std::numeric_limits<uint32_t>::max()}};
     };
 
 } // namespace rpp::details
@@ -93,6 +111,10 @@ namespace rpp
 {
     inline composite_disposable_wrapper refcount_disposable::add_ref()
     {
+        auto state = ptr_from_this();
+        if (!state)
+            return composite_disposable_wrapper::empty();
+
         auto current_value = m_refcount.load(std::memory_order::seq_cst);
         while (true)
         {
@@ -102,8 +124,15 @@ namespace rpp
             // just need atomicity, not guarding anything
             if (m_refcount.compare_exchange_strong(current_value, current_value + 1, std::memory_order::seq_cst))
             {
-                auto inner = composite_disposable_wrapper::make<details::refocunt_disposable_inner>(wrapper_from_this());
-                add(inner.as_weak());
+                auto inner = disposable_wrapper_impl<details::refocunt_disposable_inner>::make(std::move(state));
+                const auto handle = add_with_handle(inner.as_weak());
+                if (const auto locked = inner.lock(); locked && handle)
+                {
+                    locked->set_handle(*handle);
+                    // token could be disposed before handle was set, so it was not able to remove itself
+                    if (locked->is_disposed())
+                        remove(*handle);
+                }
                 return inner;
             }
         }
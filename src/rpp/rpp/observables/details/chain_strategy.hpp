@@ -13,13 +13,22 @@
 #include <rpp/observers/fwd.hpp>
 
 #include <rpp/defs.hpp>
+#include <rpp/disposables/details/subscription_arena.hpp>
+#include <rpp/observables/details/fused_strategy.hpp>
 #include <rpp/schedulers/current_thread.hpp>
 
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
 namespace rpp::details::observables
 {
     template<typename TStrategy, typename... TStrategies>
     class chain
     {
+        template<typename TTStrategy, typename... TTStrategies>
+        friend class chain;
+
         using base = chain<TStrategies...>;
 
         using operator_traits = typename TStrategy::template operator_traits<typename base::value_type>;
@@ -46,8 +55,12 @@ namespace rpp::details::observables
         void subscribe(Observer&& observer) const
         {
             [[maybe_unused]] const auto drain_on_exit = own_current_thread_if_needed();
+            // states of all operators of chain are placed into one chunk of memory
+            const rpp::details::disposables::subscription_arena::scope arena_scope{};
 
-            if constexpr (rpp::constraint::operator_lift_with_disposables_strategy<TStrategy, typename base::value_type, typename base::optimal_disposables_strategy>)
+            if constexpr (s_fusible_count > 1)
+                subscribe_fused(std::forward<Observer>(observer));
+            else if constexpr (rpp::constraint::operator_lift_with_disposables_strategy<TStrategy, typename base::value_type, typename base::optimal_disposables_strategy>)
                 m_strategies.subscribe(m_strategy.template lift_with_disposables_strategy<typename base::value_type, typename base::optimal_disposables_strategy>(std::forward<Observer>(observer)));
             else if constexpr (rpp::constraint::operator_lift<TStrategy, typename base::value_type>)
                 m_strategies.subscribe(m_strategy.template lift<typename base::value_type>(std::forward<Observer>(observer)));
@@ -59,6 +72,49 @@ namespace rpp::details::observables
         }
 
     private:
+        // amount of adjacent fusible operators starting from this one
+        static constexpr size_t s_fusible_count = [] {
+            if constexpr (rpp::constraint::operator_fusible<TStrategy>)
+                return 1 + base::s_fusible_count;
+            else
+                return size_t{0};
+        }();
+
+        /**
+         * @brief Subscribes single observer running all adjacent fusible operators instead of lifting observer through each of them
+         */
+        template<typename Observer>
+        void subscribe_fused(Observer&& observer) const
+        {
+            const auto& upstream = get_chain<s_fusible_count>();
+            using upstream_type  = typename std::decay_t<decltype(upstream)>::value_type;
+
+            std::apply([&]<typename... Stages>(Stages&&... stages) {
+                upstream.subscribe(rpp::observer<upstream_type, fused_observer_strategy<std::decay_t<Observer>, std::decay_t<Stages>...>>{std::forward<Observer>(observer), std::forward<Stages>(stages)...});
+            },
+                       make_fused_stages<s_fusible_count>());
+        }
+
+        // stages of `Count` operators starting from this one in order of data flow (from upstream to downstream)
+        template<size_t Count>
+        auto make_fused_stages() const
+        {
+            if constexpr (Count == 1)
+                return std::tuple{m_strategy.make_fused_stage()};
+            else
+                return std::tuple_cat(m_strategies.template make_fused_stages<Count - 1>(), std::tuple{m_strategy.make_fused_stage()});
+        }
+
+        // chain placed `Depth` operators upstream of this one
+        template<size_t Depth>
+        const auto& get_chain() const
+        {
+            if constexpr (Depth == 1)
+                return m_strategies;
+            else
+                return m_strategies.template get_chain<Depth - 1>();
+        }
+
         static auto own_current_thread_if_needed()
         {
             if constexpr (requires { requires operator_traits::own_current_queue; })
@@ -75,6 +131,11 @@ namespace rpp::details::observables
     template<typename TStrategy>
     class chain<TStrategy>
     {
+        template<typename TTStrategy, typename... TTStrategies>
+        friend class chain;
+
+        static constexpr size_t s_fusible_count = 0;
+
     public:
         using optimal_disposables_strategy = typename TStrategy::optimal_disposables_strategy;
         using value_type                   = typename TStrategy::value_type;
@@ -87,6 +148,8 @@ namespace rpp::details::observables
         template<rpp::constraint::observer Observer>
         void subscribe(Observer&& observer) const
         {
+            // source can emit during subscription, so anything created there has own lifetime
+            const rpp::details::disposables::subscription_arena::suspend_scope suspend_arena{};
             m_strategy.subscribe(std::forward<Observer>(observer));
         }
 
@@ -20,7 +20,7 @@ namespace rpp::details::observables
         template<size_t Count>
         using add = dynamic_disposables_strategy;
 
-        using disposables_container         = disposables::dynamic_disposables_container;
+        using disposables_container         = disposables::small_disposables_container;
         using observer_disposables_strategy = observers::dynamic_disposables_strategy;
     };
 
@@ -0,0 +1,144 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/observers/fwd.hpp>
+
+#include <rpp/defs.hpp>
+#include <rpp/observers/demand.hpp>
+#include <rpp/utils/tuple.hpp>
+
+#include <exception>
+#include <utility>
+
+namespace rpp::details::observables
+{
+    /**
+     * @brief Observer strategy running several adjacent fusible operators of chain (see @link rpp::constraint::operator_fusible @endlink) inside one observer.
+     *
+     * @details Stages are kept in order of data flow: stage `I` passes values to stage `I+1`, last one passes them to `TObserver`. Exception of stage is passed to its own `on_error` (so downstream stages see it exactly as with separate observers), terminal events are not passed to stages after disposal.
+     *
+     * Disposed state of `TObserver` is checked before each stage except of first one (it is guarded by observer owning this strategy): callable of stage can dispose subscription while handling value, so next stages don't see this value same as with separate observers.
+     */
+    template<rpp::constraint::observer TObserver, typename... Stages>
+    class fused_observer_strategy
+    {
+        static constexpr size_t s_stages_count = sizeof...(Stages);
+
+        // downstream part of chain starting with stage `I`
+        template<size_t I>
+        class downstream
+        {
+        public:
+            explicit downstream(const fused_observer_strategy& strategy)
+                : m_strategy{strategy}
+            {
+            }
+
+            template<typename T>
+            void on_next(T&& v) const
+            {
+                if constexpr (I == s_stages_count)
+                    m_strategy.m_observer.on_next(std::forward<T>(v));
+                else if (!m_strategy.is_disposed())
+                {
+                    try
+                    {
+                        m_strategy.template stage_on_next<I>(std::forward<T>(v));
+                    }
+                    catch (...)
+                    {
+                        on_error(std::current_exception());
+                    }
+                }
+            }
+
+            void on_error(const std::exception_ptr& err) const noexcept
+            {
+                if constexpr (I == s_stages_count)
+                    m_strategy.m_observer.on_error(err);
+                else if (!m_strategy.is_disposed())
+                    m_strategy.template stage_on_error<I>(err);
+            }
+
+            void on_completed() const noexcept
+            {
+                if constexpr (I == s_stages_count)
+                    m_strategy.m_observer.on_completed();
+                else if (!m_strategy.is_disposed())
+                    m_strategy.template stage_on_completed<I>();
+            }
+
+            rpp::demand get_demand() const noexcept { return m_strategy.get_demand(); }
+
+        private:
+            const fused_observer_strategy& m_strategy;
+        };
+
+    public:
+        static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
+
+        template<typename... TStages>
+        fused_observer_strategy(TObserver&& observer, TStages&&... stages)
+            : m_observer{std::move(observer)}
+            , m_stages{std::forward<TStages>(stages)...}
+        {
+        }
+
+        // first stage is guarded by observer owning this strategy
+        template<typename T>
+        void on_next(T&& v) const
+        {
+            stage_on_next<0>(std::forward<T>(v));
+        }
+
+        void on_error(const std::exception_ptr& err) const { stage_on_error<0>(err); }
+
+        void on_completed() const { stage_on_completed<0>(); }
+
+        void set_upstream(const disposable_wrapper& d) { m_observer.set_upstream(d); }
+
+        bool is_disposed() const { return m_observer.is_disposed(); }
+
+        rpp::demand get_demand() const { return m_observer.get_demand(); }
+
+    private:
+        template<size_t I, typename T>
+        void stage_on_next(T&& v) const
+        {
+            m_stages.template get<I>().on_next(std::forward<T>(v), downstream<I + 1>{*this});
+        }
+
+        template<size_t I>
+        void stage_on_error(const std::exception_ptr& err) const
+        {
+            const auto& stage = m_stages.template get<I>();
+            if constexpr (requires { stage.on_error(err, downstream<I + 1>{*this}); })
+                stage.on_error(err, downstream<I + 1>{*this});
+            else
+                downstream<I + 1>{*this}.on_error(err);
+        }
+
+        template<size_t I>
+        void stage_on_completed() const
+        {
+            const auto& stage = m_stages.template get<I>();
+            if constexpr (requires { stage.on_completed(downstream<I + 1>{*this}); })
+                stage.on_completed(downstream<I + 1>{*this});
+            else
+                downstream<I + 1>{*this}.on_completed();
+        }
+
+    private:
+        RPP_NO_UNIQUE_ADDRESS TObserver                    m_observer;
+        RPP_NO_UNIQUE_ADDRESS rpp::utils::tuple<Stages...> m_stages;
+    };
+} // namespace rpp::details::observables
@@ -15,7 +15,10 @@
 #include <rpp/observables/observable.hpp>
 #include <rpp/observers/dynamic_observer.hpp>
 
+#include <cstddef>
 #include <memory>
+#include <new>
+#include <type_traits>
 #include <utility>
 
 namespace rpp::details::observables
@@ -23,12 +26,21 @@ namespace rpp::details::observables
     template<typename T, typename Observable>
     void forwarding_subscribe(const void* const ptr, dynamic_observer<T>&& obs)
     {
-        static_cast<const Observable*>(ptr)->subscribe(std::move(obs));
+        std::launder(static_cast<const Observable*>(ptr))->subscribe(std::move(obs));
     }
 
-    template<rpp::constraint::decayed_type Type>
+    /**
+     * @brief Strategy of `rpp::dynamic_observable`
+     * @details Small trivially copyable observables (stateless sources, `just` of trivial values, chains of operators with trivial lambdas and etc) are placed inline, so construction and copying of dynamic_observable doesn't allocate. Any other observable is placed into `std::shared_ptr` and shared between copies (observable is immutable, so it is the same as copy-on-write).
+     */
+    template<rpp::constraint::decayed_type Type, size_t InlineSize>
     class dynamic_strategy final
     {
+        template<typename Observable>
+        static constexpr bool s_is_inline = sizeof(Observable) <= InlineSize
+                                         && alignof(Observable) <= alignof(std::max_align_t)
+                                         && std::is_trivially_copyable_v<Observable>;
+
     public:
         using value_type                   = Type;
         using optimal_disposables_strategy = rpp::details::observables::default_disposables_strategy;
@@ -36,26 +48,38 @@ namespace rpp::details::observables
         template<rpp::constraint::observable_strategy<Type> Strategy>
             requires (!rpp::constraint::decayed_same_as<Strategy, dynamic_strategy<Type>>)
         explicit dynamic_strategy(observable<Type, Strategy>&& obs)
-            : m_forwarder{std::make_shared<observable<Type, Strategy>>(std::move(obs))}
-            , m_vtable{vtable::template create<observable<Type, Strategy>>()}
+            : m_vtable{vtable::template create<observable<Type, Strategy>>()}
         {
+            emplace(std::move(obs));
         }
 
         template<rpp::constraint::observable_strategy<Type> Strategy>
             requires (!rpp::constraint::decayed_same_as<Strategy, dynamic_strategy<Type>>)
         explicit dynamic_strategy(const observable<Type, Strategy>& obs)
-            : m_forwarder{std::make_shared<observable<Type, Strategy>>(obs)}
-            , m_vtable{vtable::template create<observable<Type, Strategy>>()}
+            : m_vtable{vtable::template create<observable<Type, Strategy>>()}
         {
+            emplace(obs);
         }
 
         template<rpp::constraint::observer_strategy<Type> ObserverStrategy>
         void subscribe(observer<Type, ObserverStrategy>&& observer) const
         {
-            m_vtable->subscribe(m_forwarder.get(), std::move(observer).as_dynamic());
+            m_vtable->subscribe(m_forwarder ? m_forwarder.get() : m_storage, std::move(observer).as_dynamic());
         }
 
     private:
+        template<typename Observable>
+        void emplace(Observable&& obs)
+        {
+            using TObservable = std::decay_t<Observable>;
+
+            // trivially copyable observable is copied/moved together with storage by memcpy
+            if constexpr (s_is_inline<TObservable>)
+                ::new (m_storage) TObservable(std::forward<Observable>(obs));
+            else
+                m_forwarder = std::make_shared<TObservable>(std::forward<Observable>(obs));
+        }
+
         struct vtable
         {
             void (*subscribe)(const void*, dynamic_observer<Type>&&){};
@@ -69,8 +93,10 @@ namespace rpp::details::observables
         };
 
     private:
-        std::shared_ptr<void> m_forwarder;
-        const vtable*         m_vtable;
+        // empty in case of observable is placed into `m_storage`
+        std::shared_ptr<void>               m_forwarder;
+        const vtable*                       m_vtable;
+        alignas(std::max_align_t) std::byte m_storage[InlineSize]{};
     };
 } // namespace rpp::details::observables
 
@@ -78,7 +104,7 @@ namespace rpp
 {
     /**
      * @brief Type-erased version of the `rpp::observable`. Any observable can be converted to dynamic_observable via `rpp::observable::as_dynamic` member function.
-     * @details To provide type-erasure it uses `std::shared_ptr`. As a result it has worse performance.
+     * @details To provide type-erasure it uses `std::shared_ptr` (small trivially copyable observables are kept inline without it). As a result it has worse performance.
      *
      * @tparam Type of value this obsevalbe can provide
      *
@@ -45,7 +45,7 @@ namespace rpp::constraint
 
 namespace rpp::details::observables
 {
-    template<rpp::constraint::decayed_type Type>
+    template<rpp::constraint::decayed_type Type, size_t InlineSize = 32>
     class dynamic_strategy;
 
     template<rpp::constraint::decayed_type Type, rpp::constraint::observable_strategy<Type> Strategy>
@@ -137,6 +137,16 @@ namespace rpp::constraint
         } -> rpp::constraint::observer_of_type<Type>;
     };
 
+    /**
+     * @concept operator_fusible
+     * @brief Stateless lift operator which can be fused with adjacent fusible operators of chain into one observer. Such an operator provides stage: same callbacks as its observer strategy has, but downstream is passed as last argument instead of being kept inside.
+     * @ingroup operators
+     */
+    template<typename Op>
+    concept operator_fusible = requires(const Op& op) {
+        op.make_fused_stage();
+    };
+
     template<typename Op, typename Type>
     concept has_operator_traits = requires() {
         typename std::decay_t<Op>::template operator_traits<Type>;
@@ -0,0 +1,266 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/observers/fwd.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace rpp::details
+{
+    /**
+     * @brief Producer waiting for demand to continue emissions.
+     * @warning `on_demand` can be called spuriously and from any thread (for example, thread calling `request`), so producer has to serialize its draining on its own.
+     */
+    class demand_waiter
+    {
+    public:
+        virtual ~demand_waiter() noexcept = default;
+
+        virtual void on_demand() noexcept = 0;
+    };
+
+    class demand_state
+    {
+    public:
+        static constexpr size_t unbounded = std::numeric_limits<size_t>::max();
+
+        explicit demand_state(size_t initial)
+            : m_requested{initial}
+        {
+        }
+
+        void request(size_t count)
+        {
+            if (count == 0)
+                return;
+
+            size_t current = m_requested.load(std::memory_order::relaxed);
+            while (current != unbounded && !m_requested.compare_exchange_weak(current, unbounded - current <= count ? unbounded : current + count, std::memory_order::seq_cst))
+            {
+            }
+
+            // pairs with `park`: either waiter sees new demand after registration or we see registered waiter here
+            if (m_waiters_count.load(std::memory_order::seq_cst) != 0)
+                resume_waiters();
+        }
+
+        bool try_consume() noexcept
+        {
+            size_t current = m_requested.load(std::memory_order::acquire);
+            while (true)
+            {
+                if (current == unbounded)
+                    return true;
+                if (current == 0)
+                    return false;
+                if (m_requested.compare_exchange_weak(current, current - 1, std::memory_order::acq_rel, std::memory_order::acquire))
+                {
+                    m_in_flight.fetch_add(1, std::memory_order::relaxed);
+                    return true;
+                }
+            }
+        }
+
+        void replenish(size_t count)
+        {
+            // only demand consumed by source can be given back: values of sources not honouring demand never consumed it
+            if (const auto taken = take_in_flight(count))
+                request(taken);
+        }
+
+        void on_delivered() noexcept { take_in_flight(1); }
+
+        size_t get_requested() const noexcept { return m_requested.load(std::memory_order::acquire); }
+
+        void park(std::shared_ptr<demand_waiter> waiter)
+        {
+            {
+                std::lock_guard lock{m_mutex};
+                m_waiters.push_back(std::move(waiter));
+                m_waiters_count.store(m_waiters.size(), std::memory_order::seq_cst);
+            }
+
+            // demand could arrive right before registration
+            if (m_requested.load(std::memory_order::seq_cst) != 0)
+                resume_waiters();
+        }
+
+    private:
+        size_t take_in_flight(size_t count) noexcept
+        {
+            size_t current = m_in_flight.load(std::memory_order::relaxed);
+            while (current != 0 && !m_in_flight.compare_exchange_weak(current, current - std::min(current, count), std::memory_order::relaxed))
+            {
+            }
+            return std::min(current, count);
+        }
+
+        void resume_waiters()
+        {
+            std::vector<std::shared_ptr<demand_waiter>> waiters{};
+            {
+                std::lock_guard lock{m_mutex};
+                waiters.swap(m_waiters);
+                m_waiters_count.store(0, std::memory_order::seq_cst);
+            }
+
+            for (const auto& waiter : waiters)
+                waiter->on_demand();
+        }
+
+    private:
+        std::atomic<size_t>                         m_requested;
+        // values consumed by sources, but not delivered to consumer or given back yet
+        std::atomic<size_t>                         m_in_flight{};
+        std::atomic<size_t>                         m_waiters_count{};
+        std::mutex                                  m_mutex{};
+        std::vector<std::shared_ptr<demand_waiter>> m_waiters{};
+    };
+} // namespace rpp::details
+
+namespace rpp::details
+{
+    class weak_demand;
+} // namespace rpp::details
+
+namespace rpp
+{
+    /**
+     * @brief Handle to demand of observer: amount of values observer is ready to obtain.
+     *
+     * @details Consumer increases demand via `request(n)`, producer decreases it by one per emitted value via `try_consume()` and parks itself via `park` when there is no demand, so it is resumed on next `request`. Demand is opt-in: empty (default constructed) demand is unbounded and costs nothing, so plain observers and sources not honouring demand keep working as before.
+     *
+     * @par Example:
+     * @code{.cpp}
+     * const auto demand = rpp::demand::make(1);
+     * rpp::source::from_iterable(values)
+     *     | rpp::operators::with_demand(demand)
+     *     | rpp::operators::subscribe([demand](int v) { process(v); demand.request(1); });
+     * @endcode
+     *
+     * @ingroup observers
+     */
+    class demand
+    {
+    public:
+        /**
+         * @brief Constructs unbounded demand.
+         */
+        demand() = default;
+
+        /**
+         * @brief Constructs bounded demand with `initial` amount of requested values.
+         */
+        static demand make(size_t initial = 0)
+        {
+            return demand{std::make_shared<details::demand_state>(initial)};
+        }
+
+        bool is_unbounded() const noexcept { return !m_state || m_state->get_requested() == details::demand_state::unbounded; }
+
+        /**
+         * @brief Requests `count` more values. Resumes producers parked due to lack of demand. Saturates at unbounded demand.
+         */
+        void request(size_t count) const
+        {
+            if (m_state)
+                m_state->request(count);
+        }
+
+        /**
+         * @brief Consumes demand for one value.
+         * @return true if value can be emitted
+         */
+        bool try_consume() const noexcept
+        {
+            return !m_state || m_state->try_consume();
+        }
+
+        /**
+         * @brief Gives back demand consumed for value which was not emitted downstream (for example, filtered out).
+         * @details Only demand actually consumed by sources via `try_consume` and not delivered to consumer yet is given back, so values of sources not honouring demand (like subjects) don't increase it.
+         */
+        void replenish(size_t count) const
+        {
+            if (m_state)
+                m_state->replenish(count);
+        }
+
+        /**
+         * @brief Marks value consumed via `try_consume` as delivered to consumer, so its demand can't be given back anymore.
+         */
+        void on_delivered() const noexcept
+        {
+            if (m_state)
+                m_state->on_delivered();
+        }
+
+        /**
+         * @brief Registers producer to be resumed once on next `request`. Producer could be resumed immediately in case of demand arrived concurrently.
+         */
+        void park(std::shared_ptr<details::demand_waiter> waiter) const
+        {
+            if (m_state)
+                m_state->park(std::move(waiter));
+            else
+                waiter->on_demand();
+        }
+
+    private:
+        friend class details::weak_demand;
+
+        explicit demand(std::shared_ptr<details::demand_state> state)
+            : m_state{std::move(state)}
+        {
+        }
+
+    private:
+        std::shared_ptr<details::demand_state> m_state{};
+    };
+} // namespace rpp
+
+namespace rpp::details
+{
+    /**
+     * @brief Demand referenced by observers of chain.
+     * @details Demand owns producers parked on it while producers own observers of chain, so observers refer to demand weakly to avoid cycle: once consumer drops its handle nobody can request values anymore, so expired demand is treated as demand of zero values and parked producers are freed together with it.
+     */
+    class weak_demand
+    {
+    public:
+        explicit weak_demand(const rpp::demand& demand)
+            : m_state{demand.m_state}
+            , m_is_bounded{demand.m_state != nullptr}
+        {
+        }
+
+        rpp::demand lock() const
+        {
+            if (!m_is_bounded)
+                return rpp::demand{};
+            if (auto state = m_state.lock())
+                return rpp::demand{std::move(state)};
+            return rpp::demand::make(0);
+        }
+
+    private:
+        std::weak_ptr<demand_state> m_state;
+        bool                        m_is_bounded;
+    };
+} // namespace rpp::details
@@ -55,9 +55,9 @@ namespace rpp::details::observers
     class boolean_disposables_strategy;
 
     /**
-     * @brief Keep disposables inside dynamic_disposables_container container (based on std::vector)
+     * @brief Keep disposables inside small_disposables_container container (inline storage with std::vector as fallback)
      */
-    using dynamic_disposables_strategy = local_disposables_strategy<disposables::dynamic_disposables_container>;
+    using dynamic_disposables_strategy = local_disposables_strategy<disposables::small_disposables_container>;
 
     /**
      * @brief Keep disposables inside static_disposables_container container (based on std::array)
@@ -15,6 +15,7 @@
 #include <rpp/observers/observer.hpp>
 
 #include <memory>
+#include <span>
 #include <utility>
 
 namespace rpp::details::observers
@@ -23,32 +24,37 @@ namespace rpp::details::observers
     class observer_vtable
     {
     public:
-        void set_upstream(const disposable_wrapper& d) noexcept { m_vtable.set_upstream_ptr(this, d); }
-        bool is_disposed() const noexcept { return m_vtable.is_disposed_ptr(this); }
+        void set_upstream(const disposable_wrapper& d) noexcept { m_vtable->set_upstream_ptr(this, d); }
+        bool is_disposed() const noexcept { return m_vtable->is_disposed_ptr(this); }
+        rpp::demand get_demand() const noexcept { return m_vtable->get_demand_ptr(this); }
 
-        void on_next(const Type& v) const noexcept { m_vtable.on_next_lvalue_ptr(this, v); }
-        void on_next(Type&& v) const noexcept { m_vtable.on_next_rvalue_ptr(this, std::move(v)); }
-        void on_error(const std::exception_ptr& err) const noexcept { m_vtable.on_error_ptr(this, err); }
-        void on_completed() const noexcept { m_vtable.on_completed_ptr(this); }
+        void on_next(const Type& v) const noexcept { m_vtable->on_next_lvalue_ptr(this, v); }
+        void on_next(Type&& v) const noexcept { m_vtable->on_next_rvalue_ptr(this, std::move(v)); }
+        void on_next_batch(std::span<const Type> values) const noexcept { m_vtable->on_next_batch_ptr(this, values); }
+        void on_error(const std::exception_ptr& err) const noexcept { m_vtable->on_error_ptr(this, err); }
+        void on_completed() const noexcept { m_vtable->on_completed_ptr(this); }
 
     protected:
         struct vtable_t
         {
             void (*const on_next_lvalue_ptr)(const observer_vtable*, const Type&){};
             void (*const on_next_rvalue_ptr)(const observer_vtable*, Type&&){};
+            void (*const on_next_batch_ptr)(const observer_vtable*, std::span<const Type>){};
             void (*const on_error_ptr)(const observer_vtable*, const std::exception_ptr&){};
             void (*const on_completed_ptr)(const observer_vtable*){};
 
             void (*const set_upstream_ptr)(observer_vtable*, const disposable_wrapper&){};
             bool (*const is_disposed_ptr)(const observer_vtable*){};
+            rpp::demand (*const get_demand_ptr)(const observer_vtable*){};
         };
 
-        observer_vtable(vtable_t&& vtable)
-            : m_vtable{std::move(vtable)}
+        explicit observer_vtable(const vtable_t* vtable)
+            : m_vtable{vtable}
         {
         }
 
-        const vtable_t m_vtable{};
+        // table is shared by all objects of the same observer type, so type-erased observer is just one pointer bigger than original one
+        const vtable_t* m_vtable;
     };
 
     template<rpp::constraint::observer TObs>
@@ -68,17 +74,27 @@ namespace rpp::details::observers
             return static_cast<type_erased_observer*>(ptr)->m_observer;
         }
 
+        static const Vtable* get_vtable() noexcept
+        {
+            static constexpr Vtable s_vtable{
+                .on_next_lvalue_ptr = +[](const Base* b, const Type& v) { cast(b).on_next(v); },
+                .on_next_rvalue_ptr = +[](const Base* b, Type&& v) { cast(b).on_next(std::move(v)); },
+                .on_next_batch_ptr  = +[](const Base* b, std::span<const Type> values) { cast(b).on_next_batch(values); },
+                .on_error_ptr       = +[](const Base* b, const std::exception_ptr& err) { cast(b).on_error(err); },
+                .on_completed_ptr   = +[](const Base* b) { cast(b).on_completed(); },
+                .set_upstream_ptr   = +[](Base* b, const rpp::disposable_wrapper& d) { cast(b).set_upstream(d); },
+                .is_disposed_ptr    = +[](const Base* b) {
+                    return cast(b).is_disposed();
+                },
+                .get_demand_ptr = +[](const Base* b) {
+                    return cast(b).get_demand();
+                }};
+            return &s_vtable;
+        }
+
     public:
         type_erased_observer(TObs&& observer)
-            : Base{Vtable{
-                  .on_next_lvalue_ptr = +[](const Base* b, const Type& v) { cast(b).on_next(v); },
-                  .on_next_rvalue_ptr = +[](const Base* b, Type&& v) { cast(b).on_next(std::move(v)); },
-                  .on_error_ptr       = +[](const Base* b, const std::exception_ptr& err) { cast(b).on_error(err); },
-                  .on_completed_ptr   = +[](const Base* b) { cast(b).on_completed(); },
-                  .set_upstream_ptr   = +[](Base* b, const rpp::disposable_wrapper& d) { cast(b).set_upstream(d); },
-                  .is_disposed_ptr    = +[](const Base* b) {
-                      return cast(b).is_disposed();
-                  }}}
+            : Base{get_vtable()}
             , m_observer{std::move(observer)}
         {
         }
@@ -87,6 +103,10 @@ namespace rpp::details::observers
         RPP_NO_UNIQUE_ADDRESS TObs m_observer;
     };
 
+    /**
+     * @brief Strategy of `rpp::dynamic_observer`
+     * @details Any dynamic_observer can be copied at any moment (even while it is emitting in another thread), so observer is allocated in `std::shared_ptr` up front and never relocated: all copies just share ownership of it.
+     */
     template<rpp::constraint::decayed_type Type>
     class dynamic_strategy final
     {
@@ -102,9 +122,12 @@ namespace rpp::details::observers
 
         void set_upstream(const disposable_wrapper& d) noexcept { m_observer->set_upstream(d); }
         bool is_disposed() const noexcept { return m_observer->is_disposed(); }
+        rpp::demand get_demand() const noexcept { return m_observer->get_demand(); }
 
         void on_next(const Type& v) const noexcept { m_observer->on_next(v); }
         void on_next(Type&& v) const noexcept { m_observer->on_next(std::move(v)); }
+        // whole batch crosses type-erasure boundary via one indirect call
+        void on_next_batch(std::span<const Type> values) const noexcept { m_observer->on_next_batch(values); }
         void on_error(const std::exception_ptr& err) const noexcept { m_observer->on_error(err); }
         void on_completed() const noexcept { m_observer->on_completed(); }
 
@@ -113,12 +136,11 @@ namespace rpp::details::observers
     };
 } // namespace rpp::details::observers
 
-
 namespace rpp
 {
     /**
      * @brief Type-erased version of the `rpp::observer`. Any observer can be converted to dynamic_observer via `rpp::observer::as_dynamic` member function.
-     * @details To provide type-erasure it uses `std::shared_ptr`. As a result it has worse performance, but it is **ONLY** way to copy observer.
+     * @details To provide type-erasure it uses `std::shared_ptr` (copies share the same observer). As a result it has worse performance, but it is **ONLY** way to copy observer.
      *
      * @tparam Type of value this observer can handle
      *
@@ -19,6 +19,12 @@
 #include <rpp/utils/utils.hpp>
 
 #include <exception>
+#include <span>
+
+namespace rpp
+{
+    class demand;
+} // namespace rpp
 
 namespace rpp::constraint
 {
@@ -49,6 +55,8 @@ namespace rpp::constraint
      * - set_upstream(disposable) for custom disposables related logic. In most cases you should OR do nothing OR just forward disposable to downstream observer (and set preferred_disposables_mode to None) OR fully handle disposales related logic properly
      * - is_disposed() for extending custom disposables related logic with indicating current status.
      * - `static constexpr rpp::details::observers::disposables_mode preferred_disposables_mode` with preferred disposables logic for observer over this strategy
+     * - (optionally) on_next_batch(std::span<const Type>) to handle contiguous batch of values at once (see @link rpp::constraint::batch_observer_strategy @endlink)
+     * - (optionally) get_demand() returning @link rpp::demand @endlink of downstream to let sources honour it (see @link rpp::constraint::demand_observer_strategy @endlink)
      *
      * @ingroup observers
      */
@@ -62,6 +70,30 @@ namespace rpp::constraint
         // if you not sure about this field - just use rpp::details::observers::disposables_mode::Auto
         { std::decay_t<S>::preferred_disposables_mode } -> rpp::constraint::decayed_same_as<rpp::details::observers::disposables_mode>; /* = rpp::details::observers::disposables_mode::Auto */
     };
+
+    /**
+     * @concept batch_observer_strategy
+     * @brief Observer strategy which can handle contiguous batch of values at once.
+     *
+     * @details `on_next_batch(std::span<const Type>)` has to behave the same as `on_next` called for each value of batch one by one. Observer checks for disposed state once before passing batch, so strategy has to stop processing batch on its own if downstream is disposed in the middle of it. Observer over strategy without such a method handles batch by calling `on_next` for each value.
+     *
+     * @ingroup observers
+     */
+    template<typename S, typename Type>
+    concept batch_observer_strategy = observer_strategy<S, Type> && requires(const S& const_strategy, std::span<const Type> values) {
+        const_strategy.on_next_batch(values);
+    };
+
+    /**
+     * @concept demand_observer_strategy
+     * @brief Observer strategy which provides demand of downstream via `get_demand()`. Observer over any other strategy has unbounded demand.
+     *
+     * @ingroup observers
+     */
+    template<typename S>
+    concept demand_observer_strategy = requires(const S& const_strategy) {
+        { const_strategy.get_demand() } -> std::same_as<rpp::demand>;
+    };
 } // namespace rpp::constraint
 
 namespace rpp::details::observers
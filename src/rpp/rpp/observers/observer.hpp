@@ -15,12 +15,14 @@
 #include <rpp/defs.hpp>
 #include <rpp/disposables/composite_disposable.hpp>
 #include <rpp/disposables/disposable_wrapper.hpp>
+#include <rpp/observers/demand.hpp>
 #include <rpp/observers/details/disposables_strategy.hpp>
 #include <rpp/utils/exceptions.hpp>
 #include <rpp/utils/functors.hpp>
 #include <rpp/utils/utils.hpp>
 
 #include <exception>
+#include <span>
 
 namespace rpp::details
 {
@@ -76,6 +78,19 @@ namespace rpp::details
             return m_disposable.is_disposed() || m_strategy.is_disposed();
         }
 
+        /**
+         * @brief Observable calls this method to get amount of values observer is ready to obtain. Sources honouring it emit only while demand can be consumed.
+         *
+         * @return demand provided by strategy (see @link rpp::constraint::demand_observer_strategy @endlink) or unbounded demand
+         */
+        rpp::demand get_demand() const noexcept
+        {
+            if constexpr (constraint::demand_observer_strategy<Strategy>)
+                return m_strategy.get_demand();
+            else
+                return rpp::demand{};
+        }
+
         /**
          * @brief Observable calls this method to notify observer about new value.
          *
@@ -112,6 +127,37 @@ namespace rpp::details
             }
         }
 
+        /**
+         * @brief Observable calls this method to notify observer about contiguous batch of new values at once. Same as calling `on_next(const Type&)` for each value of batch one by one.
+         *
+         * @details Strategies satisfying @link rpp::constraint::batch_observer_strategy @endlink obtain whole batch, so it can cross operators and locks once per batch instead of once per value.
+         */
+        void on_next_batch(std::span<const Type> values) const noexcept
+        {
+            try
+            {
+                if constexpr (constraint::batch_observer_strategy<Strategy, Type>)
+                {
+                    if (!values.empty() && !is_disposed())
+                        m_strategy.on_next_batch(values);
+                }
+                else
+                {
+                    for (const auto& v : values)
+                    {
+                        if (is_disposed())
+                            return;
+
+                        m_strategy.on_next(v);
+                    }
+                }
+            }
+            catch (...)
+            {
+                on_error(std::current_exception());
+            }
+        }
+
         /**
          * @brief Observable calls this method to notify observer about some error during generation next data.
          * @invariant Obtaining of this call means no any further on_next/on_error or on_completed calls from this Observable
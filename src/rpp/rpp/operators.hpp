@@ -177,6 +177,7 @@
 #include <rpp/operators/subscribe_on.hpp>
 #include <rpp/operators/tap.hpp>
 #include <rpp/operators/timeout.hpp>
+#include <rpp/operators/with_demand.hpp>
 
 /**
  * @defgroup connectable_operators Connectable Operators
@@ -15,7 +15,9 @@
 #include <rpp/defs.hpp>
 #include <rpp/operators/details/strategy.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <span>
 
 namespace rpp::operators::details
 {
@@ -49,6 +51,29 @@ namespace rpp::operators::details
             }
         }
 
+        template<typename T>
+        void on_next_batch(std::span<const T> values) const
+        {
+            while (!values.empty())
+            {
+                const auto size = std::min(m_bucket.capacity() - m_bucket.size(), values.size());
+                m_bucket.insert(m_bucket.end(), values.begin(), values.begin() + static_cast<std::ptrdiff_t>(size));
+                values = values.subspan(size);
+
+                if (m_bucket.size() == m_bucket.capacity())
+                {
+                    const auto capacity = m_bucket.capacity();
+                    m_observer.on_next(std::move(m_bucket));
+
+                    m_bucket.clear();
+                    m_bucket.reserve(capacity);
+
+                    if (m_observer.is_disposed())
+                        return;
+                }
+            }
+        }
+
         void on_error(const std::exception_ptr& err) const { m_observer.on_error(err); }
 
         void on_completed() const
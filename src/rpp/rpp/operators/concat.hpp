@@ -40,7 +40,8 @@ namespace rpp::operators::details
     {
     public:
         concat_disposable(TObserver&& observer)
-            : m_observer{std::move(observer)}
+            : m_demand{observer.get_demand()}
+            , m_observer{std::move(observer)}
         {
         }
 
@@ -49,6 +50,8 @@ namespace rpp::operators::details
 
         std::atomic<ConcatStage>& stage() { return m_stage; }
 
+        rpp::demand get_demand() const { return m_demand.lock(); }
+
         void drain()
         {
             while (!is_disposed())
@@ -82,7 +85,7 @@ namespace rpp::operators::details
         bool handle_observable_impl(const rpp::constraint::decayed_same_as<TObservable> auto& observable)
         {
             stage().store(ConcatStage::Draining, std::memory_order::relaxed);
-            observable.subscribe(concat_inner_observer_strategy<TObservable, TObserver>{disposable_wrapper_impl<concat_disposable>{this->wrapper_from_this()}.lock()});
+            observable.subscribe(concat_inner_observer_strategy<TObservable, TObserver>{this->ptr_from_this()});
 
             ConcatStage current = ConcatStage::Draining;
             return stage().compare_exchange_strong(current, ConcatStage::Processing, std::memory_order::seq_cst);
@@ -105,6 +108,7 @@ namespace rpp::operators::details
         }
 
     private:
+        rpp::details::weak_demand                             m_demand;
         rpp::utils::value_with_mutex<TObserver>               m_observer;
         rpp::utils::value_with_mutex<std::queue<TObservable>> m_queue;
         std::atomic<ConcatStage>                              m_stage{};
@@ -117,7 +121,7 @@ namespace rpp::operators::details
     {
         static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::Boolean;
 
-        std::shared_ptr<concat_disposable<TObservable, TObserver>> disposable{};
+        rpp::details::disposable_ptr<concat_disposable<TObservable, TObserver>> disposable{};
 
         template<typename T>
         void on_next(T&& v) const
@@ -146,6 +150,8 @@ namespace rpp::operators::details
         void set_upstream(const disposable_wrapper& d) const { disposable->get_inner_child_disposable().add(d); }
 
         bool is_disposed() const { return disposable->get_inner_child_disposable().is_disposed(); }
+
+        rpp::demand get_demand() const { return disposable->get_demand(); }
     };
 
     template<rpp::constraint::observable TObservable, rpp::constraint::observer TObserver>
@@ -153,7 +159,7 @@ namespace rpp::operators::details
     {
         static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
 
-        std::shared_ptr<concat_disposable<TObservable, TObserver>> disposable;
+        rpp::details::disposable_ptr<concat_disposable<TObservable, TObserver>> disposable;
 
         concat_observer_strategy(TObserver&& observer)
             : disposable{init_state(std::move(observer))}
@@ -187,7 +193,7 @@ namespace rpp::operators::details
         bool is_disposed() const { return disposable->get_base_child_disposable().is_disposed(); }
 
     private:
-        static std::shared_ptr<concat_disposable<TObservable, TObserver>> init_state(TObserver&& observer)
+        static rpp::details::disposable_ptr<concat_disposable<TObservable, TObserver>> init_state(TObserver&& observer)
         {
             const auto d   = disposable_wrapper_impl<concat_disposable<TObservable, TObserver>>::make(std::move(observer));
             auto       ptr = d.lock();
@@ -24,7 +24,7 @@ namespace rpp::operators::details
     template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposables_container Container>
     struct debounce_disposable_wrapper
     {
-        std::shared_ptr<debounce_disposable<Observer, Worker, Container>> disposable{};
+        rpp::details::disposable_ptr<debounce_disposable<Observer, Worker, Container>> disposable{};
 
         bool is_disposed() const { return disposable->is_disposed(); }
 
@@ -81,7 +81,7 @@ namespace rpp::operators::details
 
                     return std::nullopt;
                 },
-                debounce_disposable_wrapper<Observer, Worker, Container>{this->wrapper_from_this().lock()});
+                debounce_disposable_wrapper<Observer, Worker, Container>{this->ptr_from_this()});
         }
 
         std::variant<std::monostate, T, schedulers::time_point> extract_value_or_time()
@@ -113,7 +113,7 @@ namespace rpp::operators::details
     {
         static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
 
-        std::shared_ptr<debounce_disposable<Observer, Worker, Container>> disposable{};
+        rpp::details::disposable_ptr<debounce_disposable<Observer, Worker, Container>> disposable{};
 
         void set_upstream(const rpp::disposable_wrapper& d) const
         {
@@ -14,10 +14,15 @@
 
 #include <rpp/defs.hpp>
 #include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/operators/details/spsc_queue.hpp>
 #include <rpp/operators/details/strategy.hpp>
+#include <rpp/overflow.hpp>
+#include <rpp/utils/exceptions.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <mutex>
-#include <queue>
+#include <optional>
 
 namespace rpp::operators::details
 {
@@ -40,26 +45,57 @@ namespace rpp::operators::details
     {
         using T = rpp::utils::extract_observer_type_t<Observer>;
 
-        delay_disposable(Observer&& in_observer, Worker&& in_worker, rpp::schedulers::duration delay)
+        delay_disposable(Observer&& in_observer, Worker&& in_worker, rpp::schedulers::duration delay, const std::optional<bounded_queue_options>& bound)
             : observer(std::move(in_observer))
             , worker{std::move(in_worker)}
             , delay{delay}
+            , bound{bound}
+            , is_locked{bound && (bound->policy == overflow_policy::drop_oldest || bound->policy == overflow_policy::latest_only)}
+            , is_blocking{bound && bound->policy == overflow_policy::block}
+            // extra slot is reserved for terminal event, so it is never dropped or blocked
+            , queue{bound ? get_capacity() + 1 : 0}
         {
         }
 
-        RPP_NO_UNIQUE_ADDRESS Observer observer;
-        RPP_NO_UNIQUE_ADDRESS Worker   worker;
-        rpp::schedulers::duration      delay;
+        size_t get_capacity() const { return std::max(size_t{1}, bound->capacity); }
 
+        RPP_NO_UNIQUE_ADDRESS Observer       observer;
+        RPP_NO_UNIQUE_ADDRESS Worker         worker;
+        rpp::schedulers::duration            delay;
+        std::optional<bounded_queue_options> bound;
+
+        // policies replacing already queued values touch consumer's side of queue, so both sides take `mutex` for them
+        const bool is_locked;
+        const bool is_blocking;
+
+        // upstream emissions are serialized, so there is exactly one producer and one consumer (drain schedulable)
+        spsc_queue<emission<T>> queue;
         std::mutex              mutex{};
-        std::queue<emission<T>> queue;
-        bool                    is_active{};
+
+        // amount of queued emissions not processed by drain yet: producer schedules drain on transition from 0, drain stops on transition to 0
+        std::atomic<size_t> pending{};
+
+        std::atomic_bool      has_blocked_producer{};
+        std::atomic<uint32_t> wake_epoch{};
+
+        void wake_blocked_producer()
+        {
+            wake_epoch.fetch_add(1, std::memory_order::release);
+            wake_epoch.notify_all();
+        }
+
+    private:
+        void composite_dispose_impl(interface_disposable::Mode) noexcept override
+        {
+            if (is_blocking)
+                wake_blocked_producer();
+        }
     };
 
     template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposables_container Container>
     struct delay_disposable_wrapper
     {
-        std::shared_ptr<delay_disposable<Observer, Worker, Container>> disposable{};
+        rpp::details::disposable_ptr<delay_disposable<Observer, Worker, Container>> disposable{};
 
         bool is_disposed() const { return disposable->is_disposed(); }
 
@@ -70,7 +106,7 @@ namespace rpp::operators::details
     struct delay_observer_strategy
     {
         static constexpr auto                                          preferred_disposables_mode = rpp::details::observers::disposables_mode::Boolean;
-        std::shared_ptr<delay_disposable<Observer, Worker, Container>> disposable{};
+        rpp::details::disposable_ptr<delay_disposable<Observer, Worker, Container>> disposable{};
 
         void set_upstream(const rpp::disposable_wrapper& d) const
         {
@@ -82,6 +118,12 @@ namespace rpp::operators::details
             return disposable->is_disposed();
         }
 
+        // values are queued only when downstream demanded them, so queue is bounded by demand of downstream
+        rpp::demand get_demand() const
+        {
+            return disposable->observer.get_demand();
+        }
+
         template<typename T>
         void on_next(T&& v) const
         {
@@ -101,68 +143,203 @@ namespace rpp::operators::details
         }
 
     private:
+        using disposable_t = delay_disposable<Observer, Worker, Container>;
+
         template<typename TT>
         void emplace(TT&& value) const
         {
-            if (const auto tp = emplace_safe(std::forward<TT>(value)))
+            // already inside of target worker with nothing queued: scheduling would just postpone emission to the end of current schedulable, so emit it directly
+            if (disposable->delay == rpp::schedulers::duration::zero() && disposable->worker.is_current_executor() && disposable->pending.load(std::memory_order::acquire) == 0)
             {
-                disposable->worker.schedule(
-                    tp.value(),
-                    [](const delay_disposable_wrapper<Observer, Worker, Container>& wrapper) { return drain_queue(wrapper.disposable); },
-                    delay_disposable_wrapper<Observer, Worker, Container>{disposable});
+                // keep `pending` non-zero while emitting, so recursive emissions from downstream are queued instead of being emitted inside of current one
+                disposable->pending.fetch_add(1, std::memory_order::acq_rel);
+                emit(*disposable, std::forward<TT>(value));
+                if (disposable->pending.fetch_sub(1, std::memory_order::acq_rel) != 1)
+                    drain_queue(*disposable);
+                return;
+            }
+
+            if constexpr (ClearOnError && rpp::constraint::decayed_same_as<std::exception_ptr, TT>)
+            {
+                // queued values are not emitted anymore: observer is disposed after error
+                disposable->observer.on_error(std::forward<TT>(value));
+            }
+            else
+            {
+                if (!push(std::forward<TT>(value)))
+                    return;
+
+                if (disposable->pending.fetch_add(1, std::memory_order::acq_rel) == 0)
+                {
+                    disposable->worker.schedule(
+                        disposable->worker.now() + disposable->delay,
+                        [](const delay_disposable_wrapper<Observer, Worker, Container>& wrapper) { return drain_queue(*wrapper.disposable); },
+                        delay_disposable_wrapper<Observer, Worker, Container>{disposable});
+                }
             }
         }
 
+        /**
+         * @return true if new emission was queued
+         */
         template<typename TT>
-        std::optional<rpp::schedulers::time_point> emplace_safe(TT&& item) const
+        bool push(TT&& item) const
         {
-            std::lock_guard lock{disposable->mutex};
-            if constexpr (ClearOnError && rpp::constraint::decayed_same_as<std::exception_ptr, TT>)
+            auto& d = *disposable;
+            // with zero delay emission is always ready, so drain doesn't need to compare it with current time
+            const auto tp = d.delay == rpp::schedulers::duration::zero() ? rpp::schedulers::time_point{} : d.worker.now() + d.delay;
+
+            if constexpr (!rpp::constraint::decayed_same_as<std::exception_ptr, TT> && !rpp::constraint::decayed_same_as<rpp::utils::none, TT>)
             {
-                disposable->queue = std::queue<emission<rpp::utils::extract_observer_type_t<Observer>>>{};
-                disposable->observer.on_error(std::forward<TT>(item));
-                return std::nullopt;
+                if (d.is_locked)
+                {
+                    std::lock_guard lock{d.mutex};
+                    if (d.queue.size_for_producer() >= d.get_capacity())
+                    {
+                        handle_replacing_overflow(std::forward<TT>(item), tp);
+                        return false;
+                    }
+
+                    d.queue.emplace(std::forward<TT>(item), tp);
+                    return true;
+                }
+
+                if (d.bound && d.queue.size_for_producer() >= d.get_capacity() && !handle_overflow())
+                    return false;
             }
-            else
+
+            d.queue.emplace(std::forward<TT>(item), tp);
+            return true;
+        }
+
+        /**
+         * @brief Handles new value arrived into full bounded queue for policies not touching queued values.
+         * @return true if value still has to be queued
+         */
+        bool handle_overflow() const
+        {
+            auto&       d       = *disposable;
+            const auto& options = d.bound.value();
+            options.statistics.on_overflow();
+
+            switch (options.policy)
             {
-                const auto tp = disposable->worker.now() + disposable->delay;
-                disposable->queue.emplace(std::forward<TT>(item), tp);
-                if (!disposable->is_active)
+            case overflow_policy::block:
+                // consumer runs on this thread: waiting for it would deadlock
+                if (d.worker.is_current_executor())
+                    break;
+
+                options.statistics.on_blocked();
+                while (d.queue.size_for_producer() >= d.get_capacity())
                 {
-                    disposable->is_active = true;
-                    return tp;
+                    const auto epoch = d.wake_epoch.load(std::memory_order::acquire);
+                    if (d.is_disposed())
+                        return false;
+
+                    d.has_blocked_producer.store(true, std::memory_order::relaxed);
+                    // pairs with fence in `drain_queue`: either drain sees flag or we see popped value
+                    std::atomic_thread_fence(std::memory_order::seq_cst);
+                    if (d.queue.size_for_producer() < d.get_capacity())
+                        break;
+
+                    d.wake_epoch.wait(epoch, std::memory_order::acquire);
                 }
-                return std::nullopt;
+                d.has_blocked_producer.store(false, std::memory_order::relaxed);
+                return !d.is_disposed();
+
+            case overflow_policy::error:
+                throw rpp::utils::queue_overflow{"Bounded queue of operator is full"};
+
+            default:
+                break;
             }
+
+            options.statistics.on_dropped();
+            return false;
         }
 
-        static schedulers::optional_delay_to drain_queue(const std::shared_ptr<delay_disposable<Observer, Worker, Container>>& disposable)
+        /**
+         * @brief Handles new value arrived into full bounded queue for `drop_oldest` and `latest_only` policies. Called under `mutex`.
+         * @details Amount of queued emissions stays the same, so `pending` is not touched.
+         */
+        template<typename TT>
+        void handle_replacing_overflow(TT&& item, rpp::schedulers::time_point tp) const
         {
+            auto&       d       = *disposable;
+            const auto& options = d.bound.value();
+            options.statistics.on_overflow();
+            options.statistics.on_dropped();
+
+            if (options.policy == overflow_policy::latest_only)
+            {
+                // replaced value is delayed from its own arrival
+                auto& back      = d.queue.back();
+                back.value      = std::forward<TT>(item);
+                back.time_point = tp;
+                return;
+            }
+
+            d.queue.front();
+            d.queue.pop();
+            d.queue.emplace(std::forward<TT>(item), tp);
+        }
+
+        static schedulers::optional_delay_to drain_queue(disposable_t& d)
+        {
+            rpp::schedulers::time_point now{};
+
+            // emissions counted in `pending` are already pushed to queue, so they are processed in bulk without re-checking of `pending` per each of them
+            size_t budget = d.pending.load(std::memory_order::acquire);
             while (true)
             {
-                std::unique_lock lock{disposable->mutex};
-                if (disposable->queue.empty())
+                size_t processed{};
+                for (; processed < budget; ++processed)
                 {
-                    disposable->is_active = false;
-                    return std::nullopt;
-                }
+                    std::unique_lock lock{d.mutex, std::defer_lock};
+                    if (d.is_locked)
+                        lock.lock();
 
-                auto& top = disposable->queue.front();
-                if (top.time_point > disposable->worker.now())
-                    return schedulers::optional_delay_to{top.time_point};
+                    auto* top = d.queue.front();
+                    if (!top)
+                        break;
 
-                auto item = std::move(top.value);
-                disposable->queue.pop();
-                lock.unlock();
+                    if (top->time_point > now && (now = d.worker.now(), top->time_point > now))
+                    {
+                        d.pending.fetch_sub(processed, std::memory_order::acq_rel);
+                        return schedulers::optional_delay_to{top->time_point};
+                    }
+
+                    auto item = std::move(top->value);
+                    d.queue.pop();
+                    if (lock.owns_lock())
+                        lock.unlock();
+
+                    if (d.is_blocking)
+                    {
+                        std::atomic_thread_fence(std::memory_order::seq_cst);
+                        if (d.has_blocked_producer.load(std::memory_order::relaxed))
+                            d.wake_blocked_producer();
+                    }
+
+                    std::visit([&](auto&& v) { emit(d, std::move(v)); }, std::move(item));
+                }
 
-                std::visit(rpp::utils::overloaded{[&](rpp::utils::extract_observer_type_t<Observer>&& v) { disposable->observer.on_next(std::move(v)); },
-                                                  [&](const std::exception_ptr& err) { disposable->observer.on_error(err); },
-                                                  [&](rpp::utils::none) {
-                                                      disposable->observer.on_completed();
-                                                  }},
-                           std::move(item));
+                budget = d.pending.fetch_sub(processed, std::memory_order::acq_rel) - processed;
+                if (budget == 0)
+                    return std::nullopt;
             }
         }
+
+        template<typename TT>
+        static void emit(disposable_t& d, TT&& value)
+        {
+            if constexpr (rpp::constraint::decayed_same_as<std::exception_ptr, TT>)
+                d.observer.on_error(value);
+            else if constexpr (rpp::constraint::decayed_same_as<rpp::utils::none, TT>)
+                d.observer.on_completed();
+            else
+                d.observer.on_next(std::forward<TT>(value));
+        }
     };
 
     template<rpp::schedulers::constraint::scheduler Scheduler, bool ClearOnError>
@@ -177,8 +354,9 @@ namespace rpp::operators::details
         template<rpp::details::observables::constraint::disposables_strategy Prev>
         using updated_optimal_disposables_strategy = rpp::details::observables::fixed_disposables_strategy<1>;
 
-        rpp::schedulers::duration       duration;
-        RPP_NO_UNIQUE_ADDRESS Scheduler scheduler;
+        rpp::schedulers::duration            duration;
+        RPP_NO_UNIQUE_ADDRESS Scheduler      scheduler;
+        std::optional<bounded_queue_options> queue_options{};
 
         template<rpp::constraint::decayed_type Type, rpp::details::observables::constraint::disposables_strategy DisposableStrategy, rpp::constraint::observer Observer>
         auto lift_with_disposables_strategy(Observer&& observer) const
@@ -186,7 +364,7 @@ namespace rpp::operators::details
             using worker_t  = rpp::schedulers::utils::get_worker_t<Scheduler>;
             using container = typename DisposableStrategy::disposables_container;
 
-            const auto disposable = disposable_wrapper_impl<delay_disposable<std::decay_t<Observer>, worker_t, container>>::make(std::forward<Observer>(observer), scheduler.create_worker(), duration);
+            const auto disposable = disposable_wrapper_impl<delay_disposable<std::decay_t<Observer>, worker_t, container>>::make(std::forward<Observer>(observer), scheduler.create_worker(), duration, queue_options);
             auto       ptr        = disposable.lock();
             ptr->observer.set_upstream(disposable.as_weak());
             return rpp::observer<Type, delay_observer_strategy<std::decay_t<Observer>, worker_t, container, ClearOnError>>{std::move(ptr)};
@@ -224,4 +402,23 @@ namespace rpp::operators
     {
         return details::delay_t<std::decay_t<Scheduler>, false>{delay_duration, std::forward<Scheduler>(scheduler)};
     }
+
+    /**
+     * @brief Same as rpp::operators::delay, but queues delayed emissions into bounded queue preallocated per subscription.
+     * @details When queue already has `options.capacity` values, new value is handled according to `options.policy` and counted in `options.statistics`. Terminal events are never dropped.
+     *
+     * @param delay_duration is the delay duration for emitting items. Delay duration should be able to cast to rpp::schedulers::duration.
+     * @param scheduler provides the threading model for delay. e.g. With a new thread scheduler, the observer sees the values in a new thread after a delay duration to the subscription.
+     * @param options capacity of queue, rpp::overflow_policy and rpp::overflow_statistics
+     * @warning rpp::overflow_policy::block waits for consumer, so it is meant for producer and consumer running on different threads. If value arrives from thread of `scheduler`'s worker itself, it is dropped instead.
+     * @note `#include <rpp/operators/delay.hpp>`
+     *
+     * @ingroup utility_operators
+     * @see https://reactivex.io/documentation/operators/delay.html
+     */
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    auto delay(rpp::schedulers::duration delay_duration, Scheduler&& scheduler, const bounded_queue_options& options)
+    {
+        return details::delay_t<std::decay_t<Scheduler>, false>{delay_duration, std::forward<Scheduler>(scheduler), options};
+    }
 } // namespace rpp::operators
@@ -52,7 +52,7 @@ namespace rpp::operators::details
         // `Auto` due to we have to dispose disposables during on_completed anyway
         static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::Auto;
 
-        std::shared_ptr<TDisposable> disposable{};
+        rpp::details::disposable_ptr<TDisposable> disposable{};
 
         void set_upstream(const rpp::disposable_wrapper& d) const
         {
@@ -117,7 +117,7 @@ namespace rpp::operators::details
         }
 
         template<typename ExpectedValue, rpp::constraint::observer Observer, size_t... I>
-        static void subscribe(const std::shared_ptr<TDisposable<Observer, TSelector, ExpectedValue, rpp::utils::extract_observable_type_t<TObservables>...>>& disposable, std::index_sequence<I...>, const TObservables&... observables)
+        static void subscribe(const rpp::details::disposable_ptr<TDisposable<Observer, TSelector, ExpectedValue, rpp::utils::extract_observable_type_t<TObservables>...>>& disposable, std::index_sequence<I...>, const TObservables&... observables)
         {
             (..., observables.subscribe(rpp::observer<rpp::utils::extract_observable_type_t<TObservables>, TStrategy<I + 1, Observer, TSelector, ExpectedValue, rpp::utils::extract_observable_type_t<TObservables>...>>{disposable}));
         }
@@ -28,7 +28,7 @@ namespace rpp::operators::details
         {
             static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
 
-            std::shared_ptr<subjects::details::subject_state<Type, false>> state{};
+            rpp::details::disposable_ptr<subjects::details::subject_state<Type, false>> state{};
 
             void set_upstream(const disposable_wrapper& d) const noexcept { state->add(d); }
 
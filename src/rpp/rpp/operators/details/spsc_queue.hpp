@@ -0,0 +1,169 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace rpp::operators::details
+{
+    /**
+     * @brief Lock-free FIFO queue for one producer thread and one consumer thread at a time.
+     *
+     * @details Values are stored in segments linked into list: producer fills tail segment and links next one when it is full, consumer follows links and retires fully read segments. Last retired segment is kept as spare and reused by producer, so queue which doesn't outgrow two segments doesn't allocate after warm-up.
+     * Segments grow from 16 up to 1024 slots, or have fixed size passed to constructor (then spare segment is preallocated in advance).
+     *
+     * @warning "Single producer" means calls of producer's methods are serialized (as `on_next` calls of observer are): they can happen from different threads, but one after another. Same for consumer.
+     */
+    template<typename T>
+    class spsc_queue
+    {
+        static constexpr size_t s_min_segment_size = 16;
+        static constexpr size_t s_max_segment_size = 1024;
+
+        struct segment
+        {
+            explicit segment(size_t capacity)
+                : slots{new std::optional<T>[capacity]}
+                , capacity{capacity}
+            {
+            }
+
+            std::unique_ptr<std::optional<T>[]> slots;
+            const size_t                         capacity;
+            std::atomic<size_t>                  published{};
+            std::atomic<segment*>                next{};
+        };
+
+    public:
+        /**
+         * @param fixed_segment_size size of each segment or 0 to grow segments on demand
+         */
+        explicit spsc_queue(size_t fixed_segment_size = 0)
+            : m_fixed_segment_size{fixed_segment_size}
+            , m_head{new segment{fixed_segment_size ? fixed_segment_size : s_min_segment_size}}
+            , m_tail{m_head}
+            , m_spare{fixed_segment_size ? new segment{fixed_segment_size} : nullptr}
+        {
+        }
+
+        spsc_queue(const spsc_queue&) = delete;
+        spsc_queue(spsc_queue&&)      = delete;
+
+        ~spsc_queue() noexcept
+        {
+            while (m_head)
+                delete std::exchange(m_head, m_head->next.load(std::memory_order::relaxed));
+            delete m_spare.load(std::memory_order::relaxed);
+        }
+
+        // ============== producer side ==============
+
+        template<typename... Args>
+        void emplace(Args&&... args)
+        {
+            if (m_tail_index == m_tail->capacity)
+                link_new_segment();
+
+            m_tail->slots[m_tail_index].emplace(std::forward<Args>(args)...);
+            m_tail->published.store(++m_tail_index, std::memory_order::release);
+            ++m_pushed;
+        }
+
+        /**
+         * @brief Last pushed value. Valid only if it was not popped yet (for example, under external lock shared with consumer).
+         */
+        T& back() { return *m_tail->slots[m_tail_index - 1]; }
+
+        /**
+         * @brief Amount of values in queue as seen by producer: can be greater than actual one if consumer pops values at the same time.
+         */
+        size_t size_for_producer() const { return m_pushed - m_popped.load(std::memory_order::acquire); }
+
+        // ============== consumer side ==============
+
+        /**
+         * @return pointer to oldest value or nullptr if queue is empty
+         */
+        T* front()
+        {
+            if (m_head_index == m_head->capacity)
+            {
+                segment* next = m_head->next.load(std::memory_order::acquire);
+                if (!next)
+                    return nullptr;
+
+                retire(std::exchange(m_head, next));
+                m_head_index = 0;
+            }
+
+            if (m_head_index == m_head->published.load(std::memory_order::acquire))
+                return nullptr;
+
+            return &*m_head->slots[m_head_index];
+        }
+
+        /**
+         * @brief Removes value obtained via `front()`
+         */
+        void pop()
+        {
+            m_head->slots[m_head_index++].reset();
+            m_popped.store(m_popped.load(std::memory_order::relaxed) + 1, std::memory_order::release);
+        }
+
+    private:
+        void link_new_segment()
+        {
+            const size_t capacity = m_fixed_segment_size ? m_fixed_segment_size : std::min(s_max_segment_size, m_tail->capacity * 2);
+
+            segment* new_segment = m_spare.exchange(nullptr, std::memory_order::acquire);
+            if (!new_segment || new_segment->capacity < capacity)
+            {
+                delete new_segment;
+                new_segment = new segment{capacity};
+            }
+
+            m_tail->next.store(new_segment, std::memory_order::release);
+            m_tail       = new_segment;
+            m_tail_index = 0;
+        }
+
+        void retire(segment* old)
+        {
+            old->published.store(0, std::memory_order::relaxed);
+            old->next.store(nullptr, std::memory_order::relaxed);
+            delete m_spare.exchange(old, std::memory_order::acq_rel);
+        }
+
+    private:
+        const size_t m_fixed_segment_size{};
+
+        // consumer side
+        segment*            m_head;
+        size_t              m_head_index{};
+        std::atomic<size_t> m_popped{};
+
+        // padding instead of alignas: owner can be placed into memory without over-alignment guarantees
+        [[maybe_unused]] char m_padding[64]{};
+
+        // producer side
+        segment* m_tail;
+        size_t   m_tail_index{};
+        size_t   m_pushed{};
+
+        std::atomic<segment*> m_spare{};
+    };
+} // namespace rpp::operators::details
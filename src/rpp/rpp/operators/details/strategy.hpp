@@ -39,6 +39,16 @@ namespace rpp::operators::details
             return m_vals.apply(&apply<Type, Observer, TArgs...>, std::forward<Observer>(observer));
         }
 
+        /**
+         * @brief Creates stage of fused observer in case of operator provides `fused_stage` type (stage is constructed from the same arguments as observer strategy, but without observer)
+         */
+        template<typename TOperator = Operator>
+            requires requires { typename TOperator::fused_stage; }
+        auto make_fused_stage() const
+        {
+            return m_vals.apply([](const TArgs&... vals) { return typename TOperator::fused_stage{vals...}; });
+        }
+
     private:
         template<rpp::constraint::decayed_type Type,
                  rpp::constraint::observer     Observer,
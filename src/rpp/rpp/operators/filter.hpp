@@ -14,7 +14,11 @@
 
 #include <rpp/defs.hpp>
 #include <rpp/operators/details/strategy.hpp>
+#include <rpp/utils/function_traits.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <span>
 #include <type_traits>
 
 namespace rpp::operators::details
@@ -22,7 +26,8 @@ namespace rpp::operators::details
     template<rpp::constraint::observer TObserver, rpp::constraint::decayed_type Fn>
     struct filter_observer_strategy
     {
-        static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
+        static constexpr auto   preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
+        static constexpr size_t s_batch_chunk_size         = 64;
 
         RPP_NO_UNIQUE_ADDRESS TObserver observer;
         RPP_NO_UNIQUE_ADDRESS Fn        fn;
@@ -32,6 +37,49 @@ namespace rpp::operators::details
         {
             if (fn(rpp::utils::as_const(v)))
                 observer.on_next(std::forward<T>(v));
+            else
+                observer.get_demand().replenish(1);
+        }
+
+        /**
+         * @brief Passes runs of accepted values downstream as sub-batches of original batch without any copies.
+         * @details Predicate is invoked ahead of passing values downstream, so it is done only for `rpp::utils::stateless_callable` and at most for `s_batch_chunk_size` values at once. Any other predicate is invoked per value via `on_next`.
+         */
+        template<typename T>
+            requires rpp::utils::stateless_callable<Fn>
+        void on_next_batch(std::span<const T> values) const
+        {
+            for (size_t offset = 0; offset < values.size() && !observer.is_disposed(); offset += s_batch_chunk_size)
+            {
+                const auto chunk = values.subspan(offset, std::min(s_batch_chunk_size, values.size() - offset));
+
+                size_t begin = 0;
+                size_t i     = 0;
+                try
+                {
+                    for (; i < chunk.size(); ++i)
+                    {
+                        if (fn(chunk[i]))
+                            continue;
+
+                        if (begin != i)
+                        {
+                            observer.on_next_batch(chunk.subspan(begin, i - begin));
+                            if (observer.is_disposed())
+                                return;
+                        }
+                        observer.get_demand().replenish(1);
+                        begin = i + 1;
+                    }
+                }
+                catch (...)
+                {
+                    // accepted values before failed one are emitted before error as usual
+                    observer.on_next_batch(chunk.subspan(begin, i - begin));
+                    throw;
+                }
+                observer.on_next_batch(chunk.subspan(begin));
+            }
         }
 
         void on_error(const std::exception_ptr& err) const { observer.on_error(err); }
@@ -41,6 +89,23 @@ namespace rpp::operators::details
         void set_upstream(const disposable_wrapper& d) { observer.set_upstream(d); }
 
         bool is_disposed() const { return observer.is_disposed(); }
+
+        rpp::demand get_demand() const { return observer.get_demand(); }
+    };
+
+    template<rpp::constraint::decayed_type Fn>
+    struct filter_fused_stage
+    {
+        RPP_NO_UNIQUE_ADDRESS Fn fn;
+
+        template<typename T>
+        void on_next(T&& v, const auto& downstream) const
+        {
+            if (fn(rpp::utils::as_const(v)))
+                downstream.on_next(std::forward<T>(v));
+            else
+                downstream.get_demand().replenish(1);
+        }
     };
 
     template<rpp::constraint::decayed_type Fn>
@@ -48,6 +113,8 @@ namespace rpp::operators::details
     {
         using lift_operator<filter_t<Fn>, Fn>::lift_operator;
 
+        using fused_stage = filter_fused_stage<Fn>;
+
         template<rpp::constraint::decayed_type T>
         struct operator_traits
         {
@@ -16,10 +16,11 @@
 
 namespace rpp::operators::details
 {
-    template<rpp::constraint::decayed_type Fn>
+    template<rpp::constraint::decayed_type Fn, rpp::constraint::decayed_type Merge>
     struct flat_map_t
     {
-        RPP_NO_UNIQUE_ADDRESS Fn m_fn;
+        RPP_NO_UNIQUE_ADDRESS Fn    m_fn;
+        RPP_NO_UNIQUE_ADDRESS Merge m_merge;
 
         template<rpp::constraint::observable TObservable>
         auto operator()(TObservable&& observable) const &
@@ -27,7 +28,7 @@ namespace rpp::operators::details
             static_assert(std::invocable<Fn, rpp::utils::extract_observable_type_t<TObservable>> && rpp::constraint::observable<std::invoke_result_t<Fn, rpp::utils::extract_observable_type_t<TObservable>>>, "fn should return observable");
             return std::forward<TObservable>(observable)
                  | rpp::ops::map(m_fn)
-                 | rpp::ops::merge();
+                 | m_merge;
         }
 
         template<rpp::constraint::observable TObservable>
@@ -36,7 +37,7 @@ namespace rpp::operators::details
             static_assert(std::invocable<Fn, rpp::utils::extract_observable_type_t<TObservable>> && rpp::constraint::observable<std::invoke_result_t<Fn, rpp::utils::extract_observable_type_t<TObservable>>>, "fn should return observable");
             return std::forward<TObservable>(observable)
                  | rpp::ops::map(std::move(m_fn))
-                 | rpp::ops::merge();
+                 | std::move(m_merge);
         }
     };
 
@@ -67,7 +68,33 @@ namespace rpp::operators
         requires (!utils::is_not_template_callable<Fn> || rpp::constraint::observable<std::invoke_result_t<Fn, rpp::utils::convertible_to_any>>)
     auto flat_map(Fn&& callable)
     {
-        return details::flat_map_t<std::decay_t<Fn>>{std::forward<Fn>(callable)};
+        return details::flat_map_t<std::decay_t<Fn>, details::merge_t>{std::forward<Fn>(callable), rpp::ops::merge()};
+    }
+
+    /**
+     * @brief Transform the items emitted by an Observable into Observables, then flatten the emissions from those into a single Observable, but keep at most `max_concurrent` of those Observables subscribed at the same time
+     *
+     * @marble flat_map_max_concurrent
+            {
+                source observable                      : +--1--2--3--|
+                operator "flat_map(1): x=>just(x,x+1)" : +--12-23-34-|
+            }
+     *
+     * @details Actually it makes `map(callable)` and then `merge(max_concurrent)`: Observables obtained while `max_concurrent` ones are active are queued and subscribed as soon as active ones complete.
+     * @details Use it to bound amount of simultaneous requests to downstream services (and resources owned by them) in case of bursts of source items.
+     *
+     * @param callable function that returns an observable for each item emitted by the source observable.
+     * @param max_concurrent maximum amount of simultaneously subscribed observables returned by callable. Value 0 is treated as 1.
+     * @note `#include <rpp/operators/flat_map.hpp>`
+     *
+     * @ingroup transforming_operators
+     * @see https://reactivex.io/documentation/operators/flatmap.html
+     */
+    template<typename Fn>
+        requires (!utils::is_not_template_callable<Fn> || rpp::constraint::observable<std::invoke_result_t<Fn, rpp::utils::convertible_to_any>>)
+    auto flat_map(Fn&& callable, size_t max_concurrent)
+    {
+        return details::flat_map_t<std::decay_t<Fn>, details::merge_limited_t>{std::forward<Fn>(callable), rpp::ops::merge(max_concurrent)};
     }
 
 } // namespace rpp::operators
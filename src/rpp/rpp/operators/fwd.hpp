@@ -15,6 +15,7 @@
 #include <rpp/subjects/fwd.hpp>
 
 #include <rpp/memory_model.hpp>
+#include <rpp/overflow.hpp>
 #include <rpp/utils/constraints.hpp>
 #include <rpp/utils/utils.hpp>
 
@@ -39,6 +40,9 @@ namespace rpp::operators
     template<rpp::schedulers::constraint::scheduler Scheduler>
     auto delay(rpp::schedulers::duration delay_duration, Scheduler&& scheduler);
 
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    auto delay(rpp::schedulers::duration delay_duration, Scheduler&& scheduler, const bounded_queue_options& options);
+
     auto distinct();
 
     template<typename EqualityFn = rpp::utils::equal_to>
@@ -60,6 +64,10 @@ namespace rpp::operators
         requires (!utils::is_not_template_callable<Fn> || rpp::constraint::observable<std::invoke_result_t<Fn, rpp::utils::convertible_to_any>>)
     auto flat_map(Fn&& callable);
 
+    template<typename Fn>
+        requires (!utils::is_not_template_callable<Fn> || rpp::constraint::observable<std::invoke_result_t<Fn, rpp::utils::convertible_to_any>>)
+    auto flat_map(Fn&& callable, size_t max_concurrent);
+
     template<typename KeySelector,
              typename ValueSelector = std::identity,
              typename KeyComparator = rpp::utils::less>
@@ -83,10 +91,14 @@ namespace rpp::operators
         requires constraint::observables_of_same_type<std::decay_t<TObservable>, std::decay_t<TObservables>...>
     auto merge_with(TObservable&& observable, TObservables&&... observables);
     auto merge();
+    auto merge(size_t max_concurrent);
 
     template<rpp::schedulers::constraint::scheduler Scheduler>
     auto observe_on(Scheduler&& scheduler, rpp::schedulers::duration delay_duration = {});
 
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    auto observe_on(Scheduler&& scheduler, const bounded_queue_options& options, rpp::schedulers::duration delay_duration = {});
+
     auto publish();
 
     template<typename Seed, typename Accumulator>
@@ -197,6 +209,8 @@ namespace rpp::operators
 
     auto window(size_t count);
 
+    auto with_demand(const rpp::demand& demand);
+
     template<rpp::constraint::observable TOpeningsObservable, typename TClosingsSelectorFn>
         requires rpp::constraint::observable<std::invoke_result_t<TClosingsSelectorFn, rpp::utils::extract_observable_type_t<TOpeningsObservable>>>
     auto window_toggle(TOpeningsObservable&& openings, TClosingsSelectorFn&& closings_selector);
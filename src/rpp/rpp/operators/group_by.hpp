@@ -74,7 +74,7 @@ namespace rpp::operators::details
         using subject_observer = decltype(std::declval<subjects::publish_subject<Type>>().get_observer());
 
         mutable std::map<TKey, subject_observer, KeyComparator> key_to_observer{};
-        std::shared_ptr<refcount_disposable>                    disposable = [&] {
+        rpp::details::disposable_ptr<refcount_disposable>                    disposable = [&] {
             auto ptr = disposable_wrapper_impl<refcount_disposable>::make().lock();
             observer.set_upstream(ptr->add_ref());
             return ptr;
@@ -131,7 +131,7 @@ namespace rpp::operators::details
             disposable->add(subj.get_disposable().as_weak());
             obs.on_next(rpp::grouped_observable_group_by<TKey, Type>{
                 key,
-                group_by_observable_strategy<Type>{subj, disposable}});
+                group_by_observable_strategy<Type>{subj, disposable->wrapper_from_this().as_weak()}});
 
             return &key_to_observer.emplace(key, subj.get_observer()).first->second;
         }
@@ -143,8 +143,8 @@ namespace rpp::operators::details
         using value_type                   = T;
         using optimal_disposables_strategy = typename rpp::subjects::publish_subject<T>::optimal_disposables_strategy;
 
-        rpp::subjects::publish_subject<T>  subj;
-        std::weak_ptr<refcount_disposable> disposable;
+        rpp::subjects::publish_subject<T>            subj;
+        disposable_wrapper_impl<refcount_disposable> disposable;
 
         template<rpp::constraint::observer_strategy<T> Strategy>
         void subscribe(observer<T, Strategy>&& obs) const
@@ -14,7 +14,12 @@
 
 #include <rpp/defs.hpp>
 #include <rpp/operators/details/strategy.hpp>
+#include <rpp/utils/function_traits.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <span>
 #include <type_traits>
 
 namespace rpp::operators::details
@@ -22,7 +27,8 @@ namespace rpp::operators::details
     template<rpp::constraint::observer TObserver, rpp::constraint::decayed_type Fn>
     struct map_observer_strategy
     {
-        static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
+        static constexpr auto   preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
+        static constexpr size_t s_batch_chunk_size         = 64;
 
         RPP_NO_UNIQUE_ADDRESS TObserver observer;
         RPP_NO_UNIQUE_ADDRESS Fn        fn;
@@ -33,6 +39,48 @@ namespace rpp::operators::details
             observer.on_next(fn(std::forward<T>(v)));
         }
 
+        /**
+         * @brief Small trivial results are collected into chunk on stack and passed downstream as batch too.
+         * @details Callable is invoked ahead of passing values downstream, so it is done only for `rpp::utils::stateless_callable`. Any other callable is invoked per value via `on_next`.
+         */
+        template<typename T>
+            requires rpp::utils::stateless_callable<Fn>
+        void on_next_batch(std::span<const T> values) const
+        {
+            using result_type = rpp::utils::extract_observer_type_t<TObserver>;
+
+            if constexpr (std::is_trivially_copyable_v<result_type> && std::is_default_constructible_v<result_type> && sizeof(result_type) * s_batch_chunk_size <= 1024)
+            {
+                std::array<result_type, s_batch_chunk_size> chunk;
+                for (size_t offset = 0; offset < values.size() && !observer.is_disposed(); offset += s_batch_chunk_size)
+                {
+                    const auto size  = std::min(s_batch_chunk_size, values.size() - offset);
+                    size_t     count = 0;
+                    try
+                    {
+                        for (; count < size; ++count)
+                            chunk[count] = fn(values[offset + count]);
+                    }
+                    catch (...)
+                    {
+                        // values mapped before failed one are emitted before error as usual
+                        observer.on_next_batch(std::span<const result_type>{chunk.data(), count});
+                        throw;
+                    }
+                    observer.on_next_batch(std::span<const result_type>{chunk.data(), size});
+                }
+            }
+            else
+            {
+                for (const auto& v : values)
+                {
+                    if (observer.is_disposed())
+                        return;
+                    observer.on_next(fn(v));
+                }
+            }
+        }
+
         void on_error(const std::exception_ptr& err) const { observer.on_error(err); }
 
         void on_completed() const { observer.on_completed(); }
@@ -40,6 +88,20 @@ namespace rpp::operators::details
         void set_upstream(const disposable_wrapper& d) { observer.set_upstream(d); }
 
         bool is_disposed() const { return observer.is_disposed(); }
+
+        rpp::demand get_demand() const { return observer.get_demand(); }
+    };
+
+    template<rpp::constraint::decayed_type Fn>
+    struct map_fused_stage
+    {
+        RPP_NO_UNIQUE_ADDRESS Fn fn;
+
+        template<typename T>
+        void on_next(T&& v, const auto& downstream) const
+        {
+            downstream.on_next(fn(std::forward<T>(v)));
+        }
     };
 
     template<rpp::constraint::decayed_type Fn>
@@ -47,6 +109,8 @@ namespace rpp::operators::details
     {
         using lift_operator<map_t<Fn>, Fn>::lift_operator;
 
+        using fused_stage = map_fused_stage<Fn>;
+
         template<rpp::constraint::decayed_type T>
         struct operator_traits
         {
@@ -14,55 +14,145 @@
 
 #include <rpp/defs.hpp>
 #include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/operators/details/spsc_queue.hpp>
 #include <rpp/operators/details/strategy.hpp>
 #include <rpp/schedulers/current_thread.hpp>
 #include <rpp/utils/tuple.hpp>
 #include <rpp/utils/utils.hpp>
 
+#include <algorithm>
 #include <atomic>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <variant>
 
 namespace rpp::operators::details
 {
+    /**
+     * @brief State of merge: serializes emissions of inner observables via "emitter loop".
+     *
+     * @details Thread which finds nobody emitting emits directly and then drains values queued by others meanwhile. Other threads just queue their values and return without waiting for downstream.
+     */
     template<rpp::constraint::observer TObserver>
-    class merge_disposable final : public composite_disposable
+    class merge_disposable : public composite_disposable
     {
+        using T        = rpp::utils::extract_observer_type_t<TObserver>;
+        using emission = std::variant<T, std::exception_ptr, rpp::utils::none>;
+
     public:
         merge_disposable(TObserver&& observer)
-            : m_observer(std::move(observer))
+            : m_demand{observer.get_demand()}
+            , m_observer(std::move(observer))
         {
         }
 
+        // called before any emission, so no need to serialize
+        void set_upstream(const rpp::disposable_wrapper& d) { m_observer.set_upstream(d); }
+
+        template<typename TT>
+        void emit(TT&& value)
+        {
+            size_t expected{};
+            if (m_wip.compare_exchange_strong(expected, 1, std::memory_order::acq_rel))
+            {
+                forward(std::forward<TT>(value));
+
+                // each increment except of own one stands for value queued by other thread meanwhile
+                if (const size_t queued = m_wip.fetch_sub(1, std::memory_order::acq_rel) - 1)
+                    drain(queued);
+                return;
+            }
+
+            enqueue(std::forward<TT>(value));
+        }
+
         // just need atomicity, not guarding anything
         void increment_on_completed() { m_on_completed_needed.fetch_add(1, std::memory_order::seq_cst); }
 
         // just need atomicity, not guarding anything
         bool decrement_on_completed() { return m_on_completed_needed.fetch_sub(1, std::memory_order::seq_cst) == 1; }
 
-        rpp::utils::pointer_under_lock<TObserver> get_observer_under_lock() { return m_observer; }
+        // inner observables share demand of downstream
+        rpp::demand get_demand() const { return m_demand.lock(); }
+
+    private:
+        template<typename TT>
+        void enqueue(TT&& value)
+        {
+            {
+                std::lock_guard lock{m_queue_mutex};
+                // queue is needed only in case of contention, so it is created lazily
+                if (!m_queue)
+                    m_queue.emplace();
+                m_queue->emplace(std::forward<TT>(value));
+            }
+
+            if (m_wip.fetch_add(1, std::memory_order::acq_rel) == 0)
+                drain(1);
+        }
+
+        /**
+         * @param count amount of values queued and counted in `m_wip`: queue is guaranteed to contain them
+         */
+        void drain(size_t count)
+        {
+            while (true)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    auto& queued = *m_queue->front();
+                    std::visit([this](auto&& v) { forward(std::move(v)); }, std::move(queued));
+                    m_queue->pop();
+                }
+
+                count = m_wip.fetch_sub(count, std::memory_order::acq_rel) - count;
+                if (count == 0)
+                    return;
+            }
+        }
+
+        template<typename TT>
+        void forward(TT&& value)
+        {
+            if constexpr (rpp::constraint::decayed_same_as<std::exception_ptr, TT>)
+                m_observer.on_error(value);
+            else if constexpr (rpp::constraint::decayed_same_as<rpp::utils::none, TT>)
+                m_observer.on_completed();
+            else
+                m_observer.on_next(std::forward<TT>(value));
+        }
 
     private:
-        rpp::utils::value_with_mutex<TObserver> m_observer{};
-        std::atomic_size_t                      m_on_completed_needed{1};
+        rpp::details::weak_demand m_demand;
+        TObserver                 m_observer;
+        std::atomic_size_t        m_on_completed_needed{1};
+
+        // amount of emissions in progress: one being emitted directly plus queued ones
+        std::atomic_size_t m_wip{};
+        // producers are serialized by mutex and consumer is serialized by `m_wip`, so spsc queue is enough
+        std::mutex                          m_queue_mutex{};
+        std::optional<spsc_queue<emission>> m_queue{};
     };
 
-    template<rpp::constraint::observer TObserver>
+    template<rpp::constraint::observer TObserver, typename TDisposable = merge_disposable<TObserver>>
     struct merge_observer_base_strategy
     {
         static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::Boolean;
-        merge_observer_base_strategy(std::shared_ptr<merge_disposable<TObserver>>&& disposable)
+        merge_observer_base_strategy(rpp::details::disposable_ptr<TDisposable>&& disposable)
             : m_disposable{std::move(disposable)}
         {
         }
 
-        merge_observer_base_strategy(const std::shared_ptr<merge_disposable<TObserver>>& disposable)
+        merge_observer_base_strategy(const rpp::details::disposable_ptr<TDisposable>& disposable)
             : m_disposable{disposable}
         {
         }
 
         void set_upstream(const rpp::disposable_wrapper& d) const
         {
-            m_disposable->add(d);
-            m_disposables.push_back(d);
+            if (const auto handle = m_disposable->add_with_handle(d))
+                m_disposables.push_back(handle.value());
         }
 
         bool is_disposed() const
@@ -72,39 +162,41 @@ namespace rpp::operators::details
 
         void on_error(const std::exception_ptr& err) const
         {
-            m_disposable->get_observer_under_lock()->on_error(err);
+            m_disposable->emit(err);
         }
 
         void on_completed() const
         {
             if (m_disposable->decrement_on_completed())
             {
-                m_disposable->get_observer_under_lock()->on_completed();
+                m_disposable->emit(rpp::utils::none{});
             }
             else
             {
-                for (const auto& v : m_disposables)
-                {
-                    m_disposable->remove(v);
-                    v.dispose();
-                }
+                for (const auto& handle : m_disposables)
+                    m_disposable->remove(handle).dispose();
             }
         }
 
     protected:
-        std::shared_ptr<merge_disposable<TObserver>> m_disposable;
-        mutable std::vector<rpp::disposable_wrapper> m_disposables{};
+        rpp::details::disposable_ptr<TDisposable>                                             m_disposable;
+        mutable std::vector<rpp::details::disposables::dynamic_disposables_container::handle> m_disposables{};
     };
 
-    template<rpp::constraint::observer TObserver>
-    struct merge_observer_inner_strategy final : public merge_observer_base_strategy<TObserver>
+    template<rpp::constraint::observer TObserver, typename TDisposable = merge_disposable<TObserver>>
+    struct merge_observer_inner_strategy : public merge_observer_base_strategy<TObserver, TDisposable>
     {
-        using merge_observer_base_strategy<TObserver>::merge_observer_base_strategy;
+        using merge_observer_base_strategy<TObserver, TDisposable>::merge_observer_base_strategy;
 
         template<typename T>
         void on_next(T&& v) const
         {
-            merge_observer_base_strategy<TObserver>::m_disposable->get_observer_under_lock()->on_next(std::forward<T>(v));
+            merge_observer_base_strategy<TObserver, TDisposable>::m_disposable->emit(std::forward<T>(v));
+        }
+
+        rpp::demand get_demand() const
+        {
+            return merge_observer_base_strategy<TObserver, TDisposable>::m_disposable->get_demand();
         }
     };
 
@@ -125,11 +217,127 @@ namespace rpp::operators::details
         }
 
     private:
-        static std::shared_ptr<merge_disposable<TObserver>> init_state(TObserver&& observer)
+        static rpp::details::disposable_ptr<merge_disposable<TObserver>> init_state(TObserver&& observer)
         {
             const auto d   = disposable_wrapper_impl<merge_disposable<TObserver>>::make(std::move(observer));
             auto       ptr = d.lock();
-            ptr->get_observer_under_lock()->set_upstream(d.as_weak());
+            ptr->set_upstream(d.as_weak());
+            return ptr;
+        }
+    };
+
+    template<rpp::constraint::observable TObservable, rpp::constraint::observer TObserver>
+    struct merge_limited_observer_inner_strategy;
+
+    /**
+     * @brief State of merge with limited amount of simultaneously subscribed inner observables: excess ones are queued and subscribed as soon as active ones complete.
+     */
+    template<rpp::constraint::observable TObservable, rpp::constraint::observer TObserver>
+    class merge_limited_disposable final : public merge_disposable<TObserver>
+        , public rpp::details::enable_wrapper_from_this<merge_limited_disposable<TObservable, TObserver>>
+    {
+    public:
+        merge_limited_disposable(TObserver&& observer, size_t max_concurrent)
+            : merge_disposable<TObserver>{std::move(observer)}
+            , m_max_concurrent{max_concurrent}
+        {
+        }
+
+        template<typename TT>
+        void add_inner(TT&& observable)
+        {
+            m_pending.lock()->push(std::forward<TT>(observable));
+            drain();
+        }
+
+        void on_inner_completed()
+        {
+            m_active.fetch_sub(1, std::memory_order::acq_rel);
+            drain();
+        }
+
+    private:
+        void drain()
+        {
+            // inner observable can complete right during subscription and call `drain` again: instead of recursion outer call just makes one more iteration
+            if (m_drain_requests.fetch_add(1, std::memory_order::acq_rel) != 0)
+                return;
+
+            size_t requests = 1;
+            while (true)
+            {
+                while (!this->is_disposed() && m_active.load(std::memory_order::acquire) < m_max_concurrent)
+                {
+                    auto observable = pop_pending();
+                    if (!observable)
+                        break;
+
+                    m_active.fetch_add(1, std::memory_order::relaxed);
+                    std::move(observable).value().subscribe(rpp::observer<rpp::utils::extract_observer_type_t<TObserver>, merge_limited_observer_inner_strategy<TObservable, TObserver>>{merge_limited_observer_inner_strategy<TObservable, TObserver>{this->ptr_from_this()}});
+                }
+
+                requests = m_drain_requests.fetch_sub(requests, std::memory_order::acq_rel) - requests;
+                if (requests == 0)
+                    return;
+            }
+        }
+
+        std::optional<TObservable> pop_pending()
+        {
+            auto queue = m_pending.lock();
+            if (queue->empty())
+                return std::nullopt;
+
+            auto observable = std::move(queue->front());
+            queue->pop();
+            return observable;
+        }
+
+    private:
+        const size_t                                          m_max_concurrent;
+        rpp::utils::value_with_mutex<std::queue<TObservable>> m_pending{};
+        std::atomic_size_t                                    m_active{};
+        std::atomic_size_t                                    m_drain_requests{};
+    };
+
+    template<rpp::constraint::observable TObservable, rpp::constraint::observer TObserver>
+    struct merge_limited_observer_inner_strategy final : public merge_observer_inner_strategy<TObserver, merge_limited_disposable<TObservable, TObserver>>
+    {
+        using base = merge_observer_inner_strategy<TObserver, merge_limited_disposable<TObservable, TObserver>>;
+        using base::base;
+
+        void on_completed() const
+        {
+            base::on_completed();
+            base::m_disposable->on_inner_completed();
+        }
+    };
+
+    template<rpp::constraint::observable TObservable, rpp::constraint::observer TObserver>
+    class merge_limited_observer_strategy final : public merge_observer_base_strategy<TObserver, merge_limited_disposable<TObservable, TObserver>>
+    {
+        using base = merge_observer_base_strategy<TObserver, merge_limited_disposable<TObservable, TObserver>>;
+
+    public:
+        merge_limited_observer_strategy(TObserver&& observer, size_t max_concurrent)
+            : base{init_state(std::move(observer), max_concurrent)}
+        {
+        }
+
+        template<typename T>
+        void on_next(T&& v) const
+        {
+            // queued observable is counted too: merge can't complete while it is not subscribed yet
+            base::m_disposable->increment_on_completed();
+            base::m_disposable->add_inner(std::forward<T>(v));
+        }
+
+    private:
+        static rpp::details::disposable_ptr<merge_limited_disposable<TObservable, TObserver>> init_state(TObserver&& observer, size_t max_concurrent)
+        {
+            const auto d   = disposable_wrapper_impl<merge_limited_disposable<TObservable, TObserver>>::make(std::move(observer), max_concurrent);
+            auto       ptr = d.lock();
+            ptr->set_upstream(d.as_weak());
             return ptr;
         }
     };
@@ -155,6 +363,27 @@ namespace rpp::operators::details
         using updated_optimal_disposables_strategy = rpp::details::observables::fixed_disposables_strategy<1>;
     };
 
+    struct merge_limited_t : lift_operator<merge_limited_t, size_t>
+    {
+        using lift_operator<merge_limited_t, size_t>::lift_operator;
+
+        template<rpp::constraint::decayed_type T>
+        struct operator_traits
+        {
+            static_assert(rpp::constraint::observable<T>, "T is not observable");
+
+            using result_type = rpp::utils::extract_observable_type_t<T>;
+
+            constexpr static bool own_current_queue = true;
+
+            template<rpp::constraint::observer_of_type<result_type> TObserver>
+            using observer_strategy = merge_limited_observer_strategy<T, std::decay_t<TObserver>>;
+        };
+
+        template<rpp::details::observables::constraint::disposables_strategy Prev>
+        using updated_optimal_disposables_strategy = rpp::details::observables::fixed_disposables_strategy<1>;
+    };
+
     template<rpp::constraint::observable... TObservables>
     struct merge_with_t
     {
@@ -198,7 +427,7 @@ namespace rpp::operators
     /**
      * @brief Converts observable of observables of items into observable of items via merging emissions.
      *
-     * @invariant According to observable contract (https://reactivex.io/documentation/contract.html) emissions from any observable should be serialized, so, resulting observable uses mutex to satisfy this requirement
+     * @invariant According to observable contract (https://reactivex.io/documentation/contract.html) emissions from any observable should be serialized, so, resulting observable serializes emissions of inner observables: thread emitting while another one is busy with downstream queues its value and returns immediately, busy thread emits queued values after its own one
      *
      * @attention During on subscribe operator takes ownership over rpp::schedulers::current_thread to allow mixing of underlying emissions
      *
@@ -216,7 +445,7 @@ namespace rpp::operators
      *
      * @par Performance notes:
      * - 2 heap allocation (1 for state, 1 to convert observer to dynamic_observer)
-     * - Acquiring mutex during all observer's calls
+     * - Uncontended emission costs 2 atomic operations, mutex is acquired only to queue value while other thread emits
      *
      * @note `#include <rpp/operators/merge.hpp>`
      *
@@ -231,10 +460,41 @@ namespace rpp::operators
         return details::merge_t{};
     }
 
+    /**
+     * @brief Converts observable of observables of items into observable of items via merging emissions, but keeps at most `max_concurrent` inner observables subscribed at the same time.
+     *
+     * @marble merge_max_concurrent
+         {
+             source observable                :
+             {
+                 +--1-2-3-|
+                 .....+4--6-|
+             }
+             operator "merge(1)" : +--1-2-3-4--6-|
+         }
+     *
+     * @details Inner observables arriving while `max_concurrent` ones are active are queued and subscribed one by one as soon as active ones complete. So, amount of simultaneous subscriptions (and resources owned by them) stays bounded even for huge bursts of inner observables.
+     * @details Resulting observables completes when ALL observables (including queued ones) completes
+     *
+     * @par Performance notes:
+     * - 2 heap allocation (1 for state, 1 to convert observer to dynamic_observer)
+     * - Each inner observable is moved into queue under mutex before subscription
+     *
+     * @param max_concurrent maximum amount of simultaneously subscribed inner observables. Value 0 is treated as 1.
+     * @note `#include <rpp/operators/merge.hpp>`
+     *
+     * @ingroup combining_operators
+     * @see https://reactivex.io/documentation/operators/merge.html
+     */
+    inline auto merge(size_t max_concurrent)
+    {
+        return details::merge_limited_t{std::max(size_t{1}, max_concurrent)};
+    }
+
     /**
      * @brief Combines submissions from current observable with other observables into one
      *
-     * @warning According to observable contract (https://reactivex.io/documentation/contract.html) emissions from any observable should be serialized, so, resulting observable uses mutex to satisfy this requirement
+     * @warning According to observable contract (https://reactivex.io/documentation/contract.html) emissions from any observable should be serialized, so, resulting observable serializes emissions the same way as rpp::operators::merge does
      *
      * @warning During on subscribe operator takes ownership over rpp::schedulers::current_thread to allow mixing of underlying emissions
      *
@@ -249,7 +509,7 @@ namespace rpp::operators
      *
      * @par Performance notes:
      * - 2 heap allocation (1 for state, 1 to convert observer to dynamic_observer)
-     * - Acquiring mutex during all observer's calls
+     * - Uncontended emission costs 2 atomic operations, mutex is acquired only to queue value while other thread emits
      *
      * @param observables are observables whose emissions would be merged with current observable
      * @note `#include <rpp/operators/merge.hpp>`
@@ -27,6 +27,7 @@ namespace rpp::operators
         }
      *
      * @details Actually this operator is just `delay`, but in case of obtaining `on_error` this operator cancels all scheduled but not emited emissions and forward error immediately. In case of you need to delay also `on_error`, use `delay` instead.
+     * @details In case of emission happens inside worker of provided scheduler itself (for example, `subscribe_on` and `observe_on` to same `thread_pool{1}`), delay duration is zero and there is no pending emissions, then emission is forwarded immediately without re-scheduling.
      *
      * @param scheduler provides the threading model for delay. e.g. With a new thread scheduler, the observer sees the values in a new thread after a delay duration to the subscription.
      * @param delay_duration is the delay duration for emitting items. Delay duration should be able to cast to rpp::schedulers::duration.
@@ -43,4 +44,29 @@ namespace rpp::operators
     {
         return details::delay_t<std::decay_t<Scheduler>, true>{delay_duration, std::forward<Scheduler>(scheduler)};
     }
+
+    /**
+     * @brief Same as rpp::operators::observe_on, but queues emissions into bounded queue preallocated per subscription.
+     * @details When queue already has `options.capacity` values, new value is handled according to `options.policy` and counted in `options.statistics`. Terminal events are never dropped.
+     *
+     * @param scheduler provides the threading model for delay. e.g. With a new thread scheduler, the observer sees the values in a new thread after a delay duration to the subscription.
+     * @param options capacity of queue, rpp::overflow_policy and rpp::overflow_statistics
+     * @param delay_duration is the delay duration for emitting items. Delay duration should be able to cast to rpp::schedulers::duration.
+     * @warning rpp::overflow_policy::block waits for consumer, so it is meant for producer and consumer running on different threads. If value arrives from thread of `scheduler`'s worker itself, it is dropped instead.
+     * @note `#include <rpp/operators/observe_on.hpp>`
+     *
+     * @par Example
+     * @code{.cpp}
+     * rpp::overflow_statistics statistics{};
+     * source | rpp::operators::observe_on(rpp::schedulers::new_thread{}, {.capacity = 1024, .policy = rpp::overflow_policy::drop_oldest, .statistics = statistics});
+     * @endcode
+     *
+     * @ingroup utility_operators
+     * @see https://reactivex.io/documentation/operators/observeon.html
+     */
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    auto observe_on(Scheduler&& scheduler, const bounded_queue_options& options, rpp::schedulers::duration delay_duration)
+    {
+        return details::delay_t<std::decay_t<Scheduler>, true>{delay_duration, std::forward<Scheduler>(scheduler), options};
+    }
 } // namespace rpp::operators
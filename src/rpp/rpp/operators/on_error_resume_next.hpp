@@ -34,7 +34,7 @@ namespace rpp::operators::details
     {
         static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
 
-        std::shared_ptr<TObserver> observer;
+        rpp::details::disposable_ptr<TObserver> observer;
 
         template<typename T>
         void on_next(T&& v) const
@@ -69,7 +69,7 @@ namespace rpp::operators::details
         {
         }
 
-        std::shared_ptr<on_error_resume_next_disposable<TObserver>> state;
+        rpp::details::disposable_ptr<on_error_resume_next_disposable<TObserver>> state;
         RPP_NO_UNIQUE_ADDRESS Selector                              selector;
 
         template<typename T>
@@ -82,7 +82,7 @@ namespace rpp::operators::details
         {
             try
             {
-                selector(err).subscribe(on_error_resume_next_inner_observer_strategy<TObserver>{std::shared_ptr<TObserver>(state, &state->observer)});
+                selector(err).subscribe(on_error_resume_next_inner_observer_strategy<TObserver>{rpp::details::disposable_ptr<TObserver>(state, &state->observer)});
             }
             catch (...)
             {
@@ -103,7 +103,7 @@ namespace rpp::operators::details
 
         bool is_disposed() const { return state->is_disposed(); }
 
-        static std::shared_ptr<on_error_resume_next_disposable<TObserver>> init_state(TObserver&& observer)
+        static rpp::details::disposable_ptr<on_error_resume_next_disposable<TObserver>> init_state(TObserver&& observer)
         {
             const auto d   = disposable_wrapper_impl<on_error_resume_next_disposable<TObserver>>::make(std::move(observer));
             auto       ptr = d.lock();
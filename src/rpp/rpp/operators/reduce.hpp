@@ -15,6 +15,9 @@
 #include <rpp/defs.hpp>
 #include <rpp/operators/details/strategy.hpp>
 
+#include <optional>
+#include <span>
+
 namespace rpp::operators::details
 {
     template<rpp::constraint::observer TObserver, rpp::constraint::decayed_type Accumulator>
@@ -33,6 +36,13 @@ namespace rpp::operators::details
             seed = accumulator(std::move(seed), std::forward<T>(v));
         }
 
+        template<typename T>
+        void on_next_batch(std::span<const T> values) const
+        {
+            for (const auto& v : values)
+                seed = accumulator(std::move(seed), v);
+        }
+
         void on_error(const std::exception_ptr& err) const { observer.on_error(err); }
 
         void on_completed() const
@@ -85,6 +95,17 @@ namespace rpp::operators::details
                 seed = std::forward<T>(v);
         }
 
+        template<typename T>
+        void on_next_batch(std::span<const T> values) const
+        {
+            auto itr = values.begin();
+            if (!seed.has_value())
+                seed = *(itr++);
+
+            for (; itr != values.end(); ++itr)
+                seed = accumulator(std::move(seed).value(), *itr);
+        }
+
         void on_error(const std::exception_ptr& err) const { observer.on_error(err); }
 
         void on_completed() const
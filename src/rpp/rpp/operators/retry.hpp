@@ -36,14 +36,14 @@ namespace rpp::operators::details
     };
 
     template<rpp::constraint::observer TObserver, typename TObservable>
-    void drain(const std::shared_ptr<retry_state_t<TObserver, TObservable>>& state);
+    void drain(const rpp::details::disposable_ptr<retry_state_t<TObserver, TObservable>>& state);
 
     template<rpp::constraint::observer TObserver, typename TObservable>
     struct retry_observer_strategy
     {
         static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::Boolean;
 
-        std::shared_ptr<retry_state_t<TObserver, TObservable>> state;
+        rpp::details::disposable_ptr<retry_state_t<TObserver, TObservable>> state;
 
         template<typename T>
         void on_next(T&& v) const
@@ -81,7 +81,7 @@ namespace rpp::operators::details
     };
 
     template<rpp::constraint::observer TObserver, typename TObservable>
-    void drain(const std::shared_ptr<retry_state_t<TObserver, TObservable>>& state)
+    void drain(const rpp::details::disposable_ptr<retry_state_t<TObserver, TObservable>>& state)
     {
         while (!state->is_disposed())
         {
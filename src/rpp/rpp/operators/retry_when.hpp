@@ -40,7 +40,7 @@ namespace rpp::operators::details
     };
 
     template<rpp::constraint::observer TObserver, typename TObservable, typename TNotifier>
-    void drain(const std::shared_ptr<retry_when_state<TObserver, TObservable, TNotifier>>& state);
+    void drain(const rpp::details::disposable_ptr<retry_when_state<TObserver, TObservable, TNotifier>>& state);
 
     template<rpp::constraint::observer TObserver,
              typename TObservable,
@@ -49,7 +49,7 @@ namespace rpp::operators::details
     {
         static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
 
-        std::shared_ptr<retry_when_state<TObserver, TObservable, TNotifier>> state;
+        rpp::details::disposable_ptr<retry_when_state<TObserver, TObservable, TNotifier>> state;
         mutable bool                                                         locally_disposed{};
 
         template<typename T>
@@ -88,7 +88,7 @@ namespace rpp::operators::details
     {
         static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
 
-        std::shared_ptr<retry_when_state<TObserver, TObservable, TNotifier>> state;
+        rpp::details::disposable_ptr<retry_when_state<TObserver, TObservable, TNotifier>> state;
 
         template<typename T>
         void on_next(T&& v) const
@@ -119,7 +119,7 @@ namespace rpp::operators::details
     };
 
     template<rpp::constraint::observer TObserver, typename TObservable, typename TNotifier>
-    void drain(const std::shared_ptr<retry_when_state<TObserver, TObservable, TNotifier>>& state)
+    void drain(const rpp::details::disposable_ptr<retry_when_state<TObserver, TObservable, TNotifier>>& state)
     {
         while (!state->is_disposed())
         {
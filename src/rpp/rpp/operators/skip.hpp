@@ -15,7 +15,9 @@
 #include <rpp/defs.hpp>
 #include <rpp/operators/details/strategy.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <span>
 
 namespace rpp::operators::details
 {
@@ -36,6 +38,14 @@ namespace rpp::operators::details
                 --count;
         }
 
+        template<typename T>
+        void on_next_batch(std::span<const T> values) const
+        {
+            const auto skipped = std::min(count, values.size());
+            count -= skipped;
+            observer.on_next_batch(values.subspan(skipped));
+        }
+
         void on_error(const std::exception_ptr& err) const { observer.on_error(err); }
 
         void on_completed() const { observer.on_completed(); }
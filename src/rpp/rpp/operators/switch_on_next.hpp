@@ -58,7 +58,7 @@ namespace rpp::operators::details
     public:
         static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
 
-        switch_on_next_inner_observer_strategy(const std::shared_ptr<switch_on_next_state_t<TObserver>>& state, composite_disposable_wrapper&& refcounted)
+        switch_on_next_inner_observer_strategy(const rpp::details::disposable_ptr<switch_on_next_state_t<TObserver>>& state, composite_disposable_wrapper&& refcounted)
             : m_state{state}
             , m_refcounted{std::move(refcounted)}
         {
@@ -86,7 +86,7 @@ namespace rpp::operators::details
         bool is_disposed() const { return m_refcounted.is_disposed(); }
 
     private:
-        std::shared_ptr<switch_on_next_state_t<TObserver>> m_state;
+        rpp::details::disposable_ptr<switch_on_next_state_t<TObserver>> m_state;
         rpp::composite_disposable_wrapper                  m_refcounted;
     };
 
@@ -135,7 +135,7 @@ namespace rpp::operators::details
         bool is_disposed() const { return m_state->get_base_child_disposable().is_disposed(); }
 
     private:
-        static std::shared_ptr<switch_on_next_state_t<TObserver>> init_state(TObserver&& observer)
+        static rpp::details::disposable_ptr<switch_on_next_state_t<TObserver>> init_state(TObserver&& observer)
         {
             const auto d   = disposable_wrapper_impl<switch_on_next_state_t<TObserver>>::make(std::move(observer));
             auto       ptr = d.lock();
@@ -144,7 +144,7 @@ namespace rpp::operators::details
         }
 
     private:
-        std::shared_ptr<switch_on_next_state_t<TObserver>> m_state;
+        rpp::details::disposable_ptr<switch_on_next_state_t<TObserver>> m_state;
     };
 
     struct switch_on_next_t : lift_operator<switch_on_next_t>
@@ -15,7 +15,9 @@
 #include <rpp/defs.hpp>
 #include <rpp/operators/details/strategy.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <span>
 
 namespace rpp::operators::details
 {
@@ -40,6 +42,17 @@ namespace rpp::operators::details
                 observer.on_completed();
         }
 
+        template<typename T>
+        void on_next_batch(std::span<const T> values) const
+        {
+            const auto size = std::min(count, values.size());
+            count -= size;
+            observer.on_next_batch(values.first(size));
+
+            if (count == 0)
+                observer.on_completed();
+        }
+
         void on_error(const std::exception_ptr& err) const { observer.on_error(err); }
 
         void on_completed() const { observer.on_completed(); }
@@ -48,7 +48,7 @@ namespace rpp::operators::details
     {
         static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::Auto;
 
-        std::shared_ptr<take_until_disposable<TObserver>> state;
+        rpp::details::disposable_ptr<take_until_disposable<TObserver>> state;
 
         void on_error(const std::exception_ptr& err) const
         {
@@ -41,6 +41,23 @@ namespace rpp::operators::details
         void set_upstream(const disposable_wrapper& d) { observer.set_upstream(d); }
 
         bool is_disposed() const { return observer.is_disposed(); }
+
+        rpp::demand get_demand() const { return observer.get_demand(); }
+    };
+
+    template<rpp::constraint::decayed_type Fn>
+    struct take_while_fused_stage
+    {
+        RPP_NO_UNIQUE_ADDRESS Fn fn;
+
+        template<typename T>
+        void on_next(T&& v, const auto& downstream) const
+        {
+            if (fn(rpp::utils::as_const(v)))
+                downstream.on_next(std::forward<T>(v));
+            else
+                downstream.on_completed();
+        }
     };
 
     template<rpp::constraint::decayed_type Fn>
@@ -48,6 +65,8 @@ namespace rpp::operators::details
     {
         using lift_operator<take_while_t<Fn>, Fn>::lift_operator;
 
+        using fused_stage = take_while_fused_stage<Fn>;
+
         template<rpp::constraint::decayed_type T>
         struct operator_traits
         {
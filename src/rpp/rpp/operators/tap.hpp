@@ -53,6 +53,38 @@ namespace rpp::operators::details
         void set_upstream(const disposable_wrapper& d) { observer.set_upstream(d); }
 
         bool is_disposed() const { return observer.is_disposed(); }
+
+        rpp::demand get_demand() const { return observer.get_demand(); }
+    };
+
+    template<
+        rpp::constraint::decayed_type OnNext,
+        rpp::constraint::decayed_type OnError,
+        rpp::constraint::decayed_type OnCompleted>
+    struct tap_fused_stage
+    {
+        RPP_NO_UNIQUE_ADDRESS OnNext      onNext;
+        RPP_NO_UNIQUE_ADDRESS OnError     onError;
+        RPP_NO_UNIQUE_ADDRESS OnCompleted onCompleted;
+
+        template<typename T>
+        void on_next(T&& v, const auto& downstream) const
+        {
+            onNext(utils::as_const(v));
+            downstream.on_next(std::forward<T>(v));
+        }
+
+        void on_error(const std::exception_ptr& err, const auto& downstream) const
+        {
+            onError(err);
+            downstream.on_error(err);
+        }
+
+        void on_completed(const auto& downstream) const
+        {
+            onCompleted();
+            downstream.on_completed();
+        }
     };
 
     template<
@@ -63,6 +95,8 @@ namespace rpp::operators::details
     {
         using operators::details::lift_operator<tap_t<OnNext, OnError, OnCompleted>, OnNext, OnError, OnCompleted>::lift_operator;
 
+        using fused_stage = tap_fused_stage<OnNext, OnError, OnCompleted>;
+
         template<rpp::constraint::decayed_type T>
         struct operator_traits
         {
@@ -51,7 +51,7 @@ namespace rpp::operators::details
     template<rpp::constraint::observer TObserver, rpp::constraint::observable TFallbackObservable, rpp::details::disposables::constraint::disposables_container Container>
     struct timeout_disposable_wrapper
     {
-        std::shared_ptr<timeout_disposable<TObserver, TFallbackObservable, Container>> disposable;
+        rpp::details::disposable_ptr<timeout_disposable<TObserver, TFallbackObservable, Container>> disposable;
 
         bool is_disposed() const { return disposable->is_disposed(); }
 
@@ -66,7 +66,7 @@ namespace rpp::operators::details
     {
         static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
 
-        std::shared_ptr<timeout_disposable<TObserver, TFallbackObservable, Container>> disposable;
+        rpp::details::disposable_ptr<timeout_disposable<TObserver, TFallbackObservable, Container>> disposable;
 
         void set_upstream(const rpp::disposable_wrapper& d) const
         {
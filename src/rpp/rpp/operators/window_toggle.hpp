@@ -76,7 +76,7 @@ namespace rpp::operators::details
     {
         static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
 
-        std::shared_ptr<rpp::refcount_disposable>                                                 disposable;
+        rpp::details::disposable_ptr<rpp::refcount_disposable>                                                 disposable;
         std::shared_ptr<TState>                                                                   state;
         rpp::composite_disposable_wrapper                                                         this_disposable;
         decltype(std::declval<TState>().on_new_subject(std::declval<typename TState::Subject>())) itr;
@@ -114,7 +114,7 @@ namespace rpp::operators::details
     {
         static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::Auto;
 
-        std::shared_ptr<rpp::refcount_disposable> disposable;
+        rpp::details::disposable_ptr<rpp::refcount_disposable> disposable;
         std::shared_ptr<TState>                   state;
 
         template<typename T>
@@ -184,7 +184,7 @@ namespace rpp::operators::details
         bool is_disposed() const { return m_disposable->is_disposed(); }
 
     private:
-        std::shared_ptr<rpp::refcount_disposable> m_disposable = disposable_wrapper_impl<rpp::refcount_disposable>::make().lock();
+        rpp::details::disposable_ptr<rpp::refcount_disposable> m_disposable = disposable_wrapper_impl<rpp::refcount_disposable>::make().lock();
         std::shared_ptr<TState>                   m_state;
     };
 
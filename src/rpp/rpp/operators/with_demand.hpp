@@ -0,0 +1,97 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/operators/fwd.hpp>
+
+#include <rpp/defs.hpp>
+#include <rpp/observers/demand.hpp>
+#include <rpp/operators/details/strategy.hpp>
+
+namespace rpp::operators::details
+{
+    template<rpp::constraint::observer TObserver>
+    struct with_demand_observer_strategy
+    {
+        static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
+
+        RPP_NO_UNIQUE_ADDRESS TObserver observer;
+        rpp::details::weak_demand       demand;
+
+        template<typename T>
+        void on_next(T&& v) const
+        {
+            demand.lock().on_delivered();
+            observer.on_next(std::forward<T>(v));
+        }
+
+        void on_error(const std::exception_ptr& err) const { observer.on_error(err); }
+
+        void on_completed() const { observer.on_completed(); }
+
+        void set_upstream(const disposable_wrapper& d) { observer.set_upstream(d); }
+
+        bool is_disposed() const { return observer.is_disposed(); }
+
+        rpp::demand get_demand() const { return demand.lock(); }
+    };
+
+    struct with_demand_t : lift_operator<with_demand_t, rpp::details::weak_demand>
+    {
+        using lift_operator<with_demand_t, rpp::details::weak_demand>::lift_operator;
+
+        template<rpp::constraint::decayed_type T>
+        struct operator_traits
+        {
+            using result_type = T;
+
+            template<rpp::constraint::observer_of_type<result_type> TObserver>
+            using observer_strategy = with_demand_observer_strategy<TObserver>;
+        };
+
+        template<rpp::details::observables::constraint::disposables_strategy Prev>
+        using updated_optimal_disposables_strategy = Prev;
+    };
+} // namespace rpp::operators::details
+
+namespace rpp::operators
+{
+    /**
+     * @brief Limits emissions of upstream by demand: upstream emits only values requested via `demand.request(n)`.
+     *
+     * @details Demand is passed upstream till the source through operators honouring it: `map`, `filter`, `tap`, `take_while`, `observe_on`, `delay`, `merge`, `merge_with`, `flat_map` and `concat` (inner observables share the demand). Sources `from_iterable`/`just` pause emissions when there is no demand and continue them on next `request`, `interval` skips ticks without demand, `create` can honour it via `observer.get_demand()`.
+     * @details Any other operator or source doesn't know about demand and keeps emitting as usual (as with unbounded demand), so this operator can be used with any observable, but limits only demand-aware part of chain.
+     *
+     * @par Performance notes:
+     * - Without this operator demand is unbounded and has no any cost
+     * - One atomic operation per emitted value of source and a few ones per value reaching this operator
+     *
+     * @param demand is demand shared between this operator and consumer. Consumer requests values via `demand.request(n)`, usually from `on_next` of observer.
+     * @note `#include <rpp/operators/with_demand.hpp>`
+     *
+     * @par Example:
+     * @code{.cpp}
+     * const auto demand = rpp::demand::make(2);
+     * rpp::source::just(1, 2, 3, 4, 5)
+     *     | rpp::operators::with_demand(demand)
+     *     | rpp::operators::subscribe([](int v) { std::cout << v << " "; });
+     * // Output: 1 2
+     * demand.request(3);
+     * // Output: 3 4 5
+     * @endcode
+     *
+     * @ingroup utility_operators
+     */
+    inline auto with_demand(const rpp::demand& demand)
+    {
+        return details::with_demand_t{rpp::details::weak_demand{demand}};
+    }
+} // namespace rpp::operators
@@ -48,7 +48,7 @@ namespace rpp::operators::details
     struct with_latest_from_inner_observer_strategy
     {
         static constexpr auto                                                          preferred_disposables_mode = rpp::details::observers::disposables_mode::Auto;
-        std::shared_ptr<with_latest_from_disposable<Observer, TSelector, RestArgs...>> disposable{};
+        rpp::details::disposable_ptr<with_latest_from_disposable<Observer, TSelector, RestArgs...>> disposable{};
 
         void set_upstream(const rpp::disposable_wrapper& d) const
         {
@@ -83,7 +83,7 @@ namespace rpp::operators::details
         using Result                                     = std::invoke_result_t<TSelector, OriginalValue, RestArgs...>;
         static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
 
-        std::shared_ptr<Disposable> disposable{};
+        rpp::details::disposable_ptr<Disposable> disposable{};
 
         void set_upstream(const rpp::disposable_wrapper& d) const
         {
@@ -161,7 +161,7 @@ namespace rpp::operators::details
         }
 
         template<rpp::constraint::observer Observer, size_t... I>
-        static void subscribe(const std::shared_ptr<with_latest_from_disposable<Observer, TSelector, rpp::utils::extract_observable_type_t<TObservables>...>>& disposable, std::index_sequence<I...>, const TObservables&... observables)
+        static void subscribe(const rpp::details::disposable_ptr<with_latest_from_disposable<Observer, TSelector, rpp::utils::extract_observable_type_t<TObservables>...>>& disposable, std::index_sequence<I...>, const TObservables&... observables)
         {
             (..., observables.subscribe(rpp::observer<rpp::utils::extract_observable_type_t<TObservables>, with_latest_from_inner_observer_strategy<I, Observer, TSelector, rpp::utils::extract_observable_type_t<TObservables>...>>{disposable}));
         }
@@ -0,0 +1,100 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace rpp
+{
+    /**
+     * @brief Policy applied to new value when bounded queue of operator (see rpp::bounded_queue_options) is full.
+     *
+     * @ingroup utility_operators
+     */
+    enum class overflow_policy : uint8_t
+    {
+        block,       ///< producer waits till consumer frees a slot
+        drop_newest, ///< new value is dropped
+        drop_oldest, ///< oldest queued value is dropped to free a slot for new one
+        latest_only, ///< newest queued value is replaced with new one, so consumer obtains latest value right after earlier queued ones
+        error        ///< rpp::utils::queue_overflow is passed to `on_error` as if it was thrown by upstream
+    };
+
+    /**
+     * @brief Counters of overflows of bounded queue of operator.
+     *
+     * @details Instances are cheap to copy: all copies share same counters, so it can be passed to operator and inspected later from any thread. Counters are relaxed atomics updated only on overflow, so queue not overflowing pays nothing.
+     *
+     * @par Example
+     * @code{.cpp}
+     * rpp::overflow_statistics statistics{};
+     * source | rpp::operators::observe_on(scheduler, {.capacity = 1024, .policy = rpp::overflow_policy::drop_oldest, .statistics = statistics}) | ...;
+     *
+     * if (statistics.snapshot().dropped != 0)
+     *     alert();
+     * @endcode
+     *
+     * @ingroup utility_operators
+     */
+    class overflow_statistics final
+    {
+        struct state_t
+        {
+            std::atomic<uint64_t> overflows{};
+            std::atomic<uint64_t> dropped{};
+            std::atomic<uint64_t> blocked{};
+        };
+
+    public:
+        struct snapshot_t
+        {
+            uint64_t overflows{}; ///< amount of values arrived when queue was full
+            uint64_t dropped{};   ///< amount of values dropped (`drop_newest`, `drop_oldest` and `latest_only` policies)
+            uint64_t blocked{};   ///< amount of times producer waited for a free slot (`block` policy)
+        };
+
+        overflow_statistics()
+            : m_state{std::make_shared<state_t>()}
+        {
+        }
+
+        void on_overflow() const noexcept { m_state->overflows.fetch_add(1, std::memory_order_relaxed); }
+        void on_dropped() const noexcept { m_state->dropped.fetch_add(1, std::memory_order_relaxed); }
+        void on_blocked() const noexcept { m_state->blocked.fetch_add(1, std::memory_order_relaxed); }
+
+        snapshot_t snapshot() const noexcept
+        {
+            return snapshot_t{.overflows = m_state->overflows.load(std::memory_order_relaxed),
+                              .dropped   = m_state->dropped.load(std::memory_order_relaxed),
+                              .blocked   = m_state->blocked.load(std::memory_order_relaxed)};
+        }
+
+    private:
+        std::shared_ptr<state_t> m_state;
+    };
+
+    /**
+     * @brief Options of bounded queue of operators queueing values between threads (`observe_on`, `delay`).
+     *
+     * @details Queue is preallocated once per subscription for `capacity` values, so memory used per hop is bounded and known in advance. When queue is full, new value is handled according to `policy`.
+     *
+     * @ingroup utility_operators
+     */
+    struct bounded_queue_options
+    {
+        size_t              capacity{};
+        overflow_policy     policy{overflow_policy::block};
+        overflow_statistics statistics{};
+    };
+} // namespace rpp
@@ -20,6 +20,10 @@
 #include <rpp/schedulers/computational.hpp>
 #include <rpp/schedulers/current_thread.hpp>
 #include <rpp/schedulers/immediate.hpp>
+#include <rpp/schedulers/instrumented.hpp>
 #include <rpp/schedulers/new_thread.hpp>
 #include <rpp/schedulers/run_loop.hpp>
+#include <rpp/schedulers/statistics.hpp>
 #include <rpp/schedulers/thread_pool.hpp>
+#include <rpp/schedulers/timer_wheel.hpp>
+#include <rpp/schedulers/work_stealing_pool.hpp>
@@ -0,0 +1,137 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2022 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace rpp::schedulers::details
+{
+    /**
+     * @brief Allocator for schedulables with thread-local free-lists per size class.
+     *
+     * @details Requested size is rounded up to the nearest size class (64, 128, 256 or 512 bytes). Freed blocks are cached in free-list of the thread which frees them and re-used by next allocations in this thread, so no any synchronization between threads is needed.
+     * Amount of cached blocks per size class is limited, blocks above this limit and blocks bigger than max size class are returned to global `operator delete`.
+     */
+    class schedulables_allocator
+    {
+        static constexpr size_t s_min_size_class_shift = 6;
+        static constexpr size_t s_size_classes_count   = 4;
+        static constexpr size_t s_max_cached_blocks    = 256;
+
+        struct free_block
+        {
+            free_block* next;
+        };
+
+        class thread_cache
+        {
+        public:
+            thread_cache() = default;
+
+            thread_cache(const thread_cache&) = delete;
+            thread_cache(thread_cache&&)      = delete;
+
+            ~thread_cache() noexcept
+            {
+                is_destroyed() = true;
+
+                for (auto& list : m_lists)
+                {
+                    while (list.head)
+                        ::operator delete(std::exchange(list.head, list.head->next));
+                }
+            }
+
+            void* try_allocate(size_t size_class)
+            {
+                auto& list = m_lists[size_class];
+                if (!list.head)
+                    return nullptr;
+
+                --list.count;
+                return std::exchange(list.head, list.head->next);
+            }
+
+            bool try_deallocate(void* ptr, size_t size_class)
+            {
+                auto& list = m_lists[size_class];
+                if (list.count == s_max_cached_blocks)
+                    return false;
+
+                ++list.count;
+                list.head = ::new (ptr) free_block{list.head};
+                return true;
+            }
+
+        private:
+            struct free_list
+            {
+                free_block* head{};
+                size_t      count{};
+            };
+
+            std::array<free_list, s_size_classes_count> m_lists{};
+        };
+
+        static bool& is_destroyed()
+        {
+            thread_local bool s_destroyed{};
+            return s_destroyed;
+        }
+
+        static thread_cache* get_cache()
+        {
+            // thread_local cache could be already destroyed during thread exit
+            if (is_destroyed())
+                return nullptr;
+
+            thread_local thread_cache s_cache{};
+            return &s_cache;
+        }
+
+        static constexpr size_t get_size_class(size_t size)
+        {
+            size_t size_class = 0;
+            while (size_class < s_size_classes_count && get_size_class_size(size_class) < size)
+                ++size_class;
+            return size_class;
+        }
+
+        static constexpr size_t get_size_class_size(size_t size_class) { return size_t{1} << (s_min_size_class_shift + size_class); }
+
+    public:
+        static void* allocate(size_t size)
+        {
+            const auto size_class = get_size_class(size);
+            if (size_class == s_size_classes_count)
+                return ::operator new(size);
+
+            if (auto* cache = get_cache())
+            {
+                if (auto* ptr = cache->try_allocate(size_class))
+                    return ptr;
+            }
+            return ::operator new(get_size_class_size(size_class));
+        }
+
+        static void deallocate(void* ptr, size_t size) noexcept
+        {
+            if (const auto size_class = get_size_class(size); size_class != s_size_classes_count)
+            {
+                if (auto* cache = get_cache(); cache && cache->try_deallocate(ptr, size_class))
+                    return;
+            }
+            ::operator delete(ptr);
+        }
+    };
+} // namespace rpp::schedulers::details
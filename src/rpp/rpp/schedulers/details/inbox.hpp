@@ -0,0 +1,114 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2022 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#pragma once
+
+#include <rpp/schedulers/details/queue.hpp>
+
+#include <atomic>
+#include <vector>
+
+namespace rpp::schedulers::details
+{
+    /**
+     * @brief Lock-free multi-producer single-consumer inbox of schedulables.
+     *
+     * @details Producers push schedulables to the intrusive stack via CAS loop. Consumer takes whole stack at once via single exchange and reverses it, so schedulables are drained in order of pushing. As consumer never takes nodes one-by-one, there is no ABA problem.
+     *
+     * @warning `drain` must be called only from the single consumer thread, `push` can be called from any thread.
+     */
+    class schedulables_inbox
+    {
+    public:
+        schedulables_inbox() = default;
+
+        schedulables_inbox(const schedulables_inbox&) = delete;
+        schedulables_inbox(schedulables_inbox&&)      = delete;
+
+        ~schedulables_inbox() noexcept
+        {
+            drain([](schedulable_ptr&&) {});
+        }
+
+        void push(schedulable_ptr&& schedulable)
+        {
+            if (!schedulable)
+                return;
+
+            auto* node = schedulable.release();
+            auto* head = m_head.load(std::memory_order_relaxed);
+            do
+            {
+                node->m_inbox_next = head;
+            } while (!m_head.compare_exchange_weak(head, node, std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        /**
+         * @brief Pushes all schedulables via single CAS, so they are drained in the same order as in provided vector. Vector is cleared.
+         */
+        void push(std::vector<schedulable_ptr>& schedulables)
+        {
+            schedulable_base* first{};
+            schedulable_base* last{};
+            for (auto& schedulable : schedulables)
+            {
+                if (!schedulable)
+                    continue;
+
+                // stack is reversed on drain, so the last schedulable should be the head
+                auto* node         = schedulable.release();
+                node->m_inbox_next = last;
+                last               = node;
+                if (!first)
+                    first = node;
+            }
+            schedulables.clear();
+
+            if (!last)
+                return;
+
+            auto* head = m_head.load(std::memory_order_relaxed);
+            do
+            {
+                first->m_inbox_next = head;
+            } while (!m_head.compare_exchange_weak(head, last, std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        bool is_empty() const { return m_head.load(std::memory_order_acquire) == nullptr; }
+
+        /**
+         * @brief Takes all pushed schedulables and passes them to `fn` in order of pushing.
+         */
+        template<typename Fn>
+        void drain(Fn&& fn)
+        {
+            auto* node = m_head.exchange(nullptr, std::memory_order_acquire);
+
+            schedulable_base* reversed{};
+            while (node)
+            {
+                auto* next         = node->m_inbox_next;
+                node->m_inbox_next = reversed;
+                reversed           = node;
+                node               = next;
+            }
+
+            while (reversed)
+            {
+                auto* next             = reversed->m_inbox_next;
+                reversed->m_inbox_next = nullptr;
+                fn(schedulable_ptr::adopt(reversed));
+                reversed = next;
+            }
+        }
+
+    private:
+        std::atomic<schedulable_base*> m_head{};
+    };
+} // namespace rpp::schedulers::details
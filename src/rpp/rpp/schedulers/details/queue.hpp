@@ -12,6 +12,7 @@
 #include <rpp/schedulers/fwd.hpp>
 
 #include <rpp/defs.hpp>
+#include <rpp/schedulers/details/allocator.hpp>
 #include <rpp/schedulers/details/utils.hpp>
 #include <rpp/utils/constraints.hpp>
 #include <rpp/utils/tuple.hpp>
@@ -19,6 +20,8 @@
 
 #include "rpp/utils/functors.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <condition_variable>
 #include <exception>
 #include <memory>
@@ -26,6 +29,7 @@
 #include <optional>
 #include <utility>
 #include <variant>
+#include <vector>
 
 namespace rpp::schedulers::details
 {
@@ -39,6 +43,12 @@ namespace rpp::schedulers::details
 
         virtual ~schedulable_base() noexcept = default;
 
+        static void* operator new(size_t size) { return schedulables_allocator::allocate(size); }
+        static void  operator delete(void* ptr, size_t size) noexcept { schedulables_allocator::deallocate(ptr, size); }
+
+        static void* operator new(size_t size, std::align_val_t alignment) { return ::operator new(size, alignment); }
+        static void  operator delete(void* ptr, size_t size, std::align_val_t alignment) noexcept { ::operator delete(ptr, size, alignment); }
+
         virtual std::optional<time_point> operator()() noexcept = 0;
 
         class advanced_call
@@ -81,17 +91,6 @@ namespace rpp::schedulers::details
 
         void set_timepoint(const time_point& timepoint) { m_time_point = timepoint; }
 
-        const std::shared_ptr<schedulable_base>& get_next() const { return m_next; }
-
-        void set_next(std::shared_ptr<schedulable_base>&& next) { m_next = std::move(next); }
-
-        void update_next(std::shared_ptr<schedulable_base>&& next)
-        {
-            if (next)
-                next->set_next(std::move(m_next));
-            m_next = std::move(next);
-        }
-
     protected:
         template<typename NowStrategy>
         auto get_advanced_call_handler() const
@@ -109,8 +108,84 @@ namespace rpp::schedulers::details
         }
 
     private:
-        std::shared_ptr<schedulable_base> m_next{};
-        time_point                        m_time_point;
+        friend class schedulable_ptr;
+        friend class schedulables_inbox;
+
+        void add_ref() noexcept { m_refcount.fetch_add(1, std::memory_order_relaxed); }
+
+        void release() noexcept
+        {
+            if (m_refcount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                delete this;
+        }
+
+    private:
+        time_point          m_time_point;
+        std::atomic<size_t> m_refcount{};
+        schedulable_base*   m_inbox_next{};
+    };
+
+    /**
+     * @brief Intrusive reference-counting pointer to schedulable. Counter is stored inside of schedulable itself, so no any separate control block is needed.
+     */
+    class schedulable_ptr
+    {
+    public:
+        schedulable_ptr() = default;
+
+        explicit schedulable_ptr(schedulable_base* ptr) noexcept
+            : m_ptr{ptr}
+        {
+            if (m_ptr)
+                m_ptr->add_ref();
+        }
+
+        schedulable_ptr(const schedulable_ptr& other) noexcept
+            : schedulable_ptr{other.m_ptr}
+        {
+        }
+
+        schedulable_ptr(schedulable_ptr&& other) noexcept
+            : m_ptr{std::exchange(other.m_ptr, nullptr)}
+        {
+        }
+
+        ~schedulable_ptr() noexcept
+        {
+            if (m_ptr)
+                m_ptr->release();
+        }
+
+        schedulable_ptr& operator=(schedulable_ptr other) noexcept
+        {
+            std::swap(m_ptr, other.m_ptr);
+            return *this;
+        }
+
+        /**
+         * @brief Takes ownership over already referenced schedulable without incrementing of counter. Opposite to `release`.
+         */
+        static schedulable_ptr adopt(schedulable_base* ptr) noexcept
+        {
+            schedulable_ptr res{};
+            res.m_ptr = ptr;
+            return res;
+        }
+
+        /**
+         * @brief Gives up ownership over schedulable without decrementing of counter. Opposite to `adopt`.
+         */
+        schedulable_base* release() noexcept { return std::exchange(m_ptr, nullptr); }
+
+        schedulable_base* get() const noexcept { return m_ptr; }
+
+        schedulable_base* operator->() const noexcept { return m_ptr; }
+        schedulable_base& operator*() const noexcept { return *m_ptr; }
+
+        explicit operator bool() const noexcept { return m_ptr != nullptr; }
+
+    private:
+        schedulable_base* m_ptr{};
     };
 
     template<typename NowStrategy, rpp::constraint::decayed_type Fn, rpp::schedulers::constraint::schedulable_handler Handler, rpp::constraint::decayed_type... Args>
@@ -168,6 +243,14 @@ namespace rpp::schedulers::details
         RPP_NO_UNIQUE_ADDRESS Fn                                  m_fn;
     };
 
+    template<typename NowStrategy, rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+    schedulable_ptr make_schedulable(const time_point& timepoint, Fn&& fn, Handler&& handler, Args&&... args)
+    {
+        using schedulable_type = specific_schedulable<NowStrategy, std::decay_t<Fn>, std::decay_t<Handler>, std::decay_t<Args>...>;
+
+        return schedulable_ptr{new schedulable_type(timepoint, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...)};
+    }
+
     template<typename Mutex>
     class optional_mutex
     {
@@ -201,9 +284,37 @@ namespace rpp::schedulers::details
         std::recursive_mutex        mutex{};
     };
 
+    /**
+     * @brief Priority queue of schedulables ordered by time_point and then by order of insertion.
+     *
+     * @details Consists of two lanes:
+     * - FIFO lane - amortized O(1) insertion for schedulables with time_point not less than time_point of last schedulable in this lane (for example, "schedule now" or monotonically increasing timers)
+     * - 4-ary heap - O(log n) insertion for any other schedulables
+     *
+     * Top of queue is the minimal one among heads of both lanes, so order is the same as for fully sorted queue.
+     *
+     * Disposed schedulables are not only skipped when reach top of queue, but also periodically removed from any position: when size of queue doubles since last compaction, all disposed schedulables are removed in one linear pass.
+     * As a result, memory held by queue (and by captured observers) tracks amount of alive schedulables instead of amount of ever scheduled ones with amortized O(1) cost per insertion.
+     */
     template<typename NowStrategy>
     class schedulables_queue
     {
+        struct entry
+        {
+            time_point      timepoint;
+            size_t          order;
+            schedulable_ptr schedulable;
+
+            bool operator<(const entry& other) const
+            {
+                return timepoint < other.timepoint || (timepoint == other.timepoint && order < other.order);
+            }
+        };
+
+        static constexpr size_t s_heap_arity                     = 4;
+        static constexpr size_t s_fifo_compaction_threshold      = 64;
+        static constexpr size_t s_min_disposed_removal_threshold = 64;
+
     public:
         schedulables_queue()                              = default;
         schedulables_queue(const schedulables_queue&)     = delete;
@@ -220,12 +331,10 @@ namespace rpp::schedulers::details
         template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
         void emplace(const time_point& timepoint, Fn&& fn, Handler&& handler, Args&&... args)
         {
-            using schedulable_type = specific_schedulable<NowStrategy, std::decay_t<Fn>, std::decay_t<Handler>, std::decay_t<Args>...>;
-
-            emplace_impl(std::make_shared<schedulable_type>(timepoint, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...));
+            emplace_impl(make_schedulable<NowStrategy>(timepoint, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...));
         }
 
-        void emplace(const time_point& timepoint, std::shared_ptr<schedulable_base>&& schedulable)
+        void emplace(const time_point& timepoint, schedulable_ptr&& schedulable)
         {
             if (!schedulable)
                 return;
@@ -234,20 +343,24 @@ namespace rpp::schedulers::details
             emplace_impl(std::move(schedulable));
         }
 
-        bool is_empty() const { return !m_head; }
+        bool is_empty() const { return is_fifo_empty() && m_heap.empty(); }
+
+        size_t size() const { return m_fifo.size() - m_fifo_head + m_heap.size(); }
 
-        std::shared_ptr<schedulable_base> pop()
+        schedulable_ptr pop()
         {
-            return std::exchange(m_head, m_head->get_next());
+            if (is_fifo_top())
+                return fifo_pop();
+            return heap_pop();
         }
 
-        const std::shared_ptr<schedulable_base>& top() const
+        const schedulable_ptr& top() const
         {
-            return m_head;
+            return is_fifo_top() ? m_fifo[m_fifo_head].schedulable : m_heap.front().schedulable;
         }
 
     private:
-        void emplace_impl(std::shared_ptr<schedulable_base>&& schedulable)
+        void emplace_impl(schedulable_ptr&& schedulable)
         {
             // needed in case of new_thread and current_thread shares same queue
             const auto                       s = m_shared_data.lock();
@@ -259,26 +372,132 @@ namespace rpp::schedulers::details
             optional_mutex<std::recursive_mutex> mutex{s ? &s->mutex : nullptr};
             std::lock_guard                      lock{mutex};
 
-            if (!m_head || schedulable->get_timepoint() < m_head->get_timepoint())
+            const auto timepoint = schedulable->get_timepoint();
+            entry      e{timepoint, m_order++, std::move(schedulable)};
+
+            if (is_fifo_empty() || !(timepoint < m_fifo.back().timepoint))
+                m_fifo.push_back(std::move(e));
+            else
+                heap_push(std::move(e));
+
+            if (size() >= m_disposed_removal_threshold)
+                remove_disposed();
+        }
+
+        void remove_disposed()
+        {
+            // destruction of schedulables is postponed till queue is consistent again as it could lead to re-entrant emplace
+            std::vector<schedulable_ptr> disposed{};
+
+            const auto is_disposed = [&disposed](entry& e) {
+                if (!e.schedulable->is_disposed())
+                    return false;
+                disposed.push_back(std::move(e.schedulable));
+                return true;
+            };
+
+            m_fifo.erase(std::remove_if(m_fifo.begin() + static_cast<std::ptrdiff_t>(m_fifo_head), m_fifo.end(), is_disposed), m_fifo.end());
+            if (is_fifo_empty())
             {
-                schedulable->set_next(std::move(m_head));
-                m_head = std::move(schedulable);
-                return;
+                m_fifo.clear();
+                m_fifo_head = 0;
             }
 
-            schedulable_base* current = m_head.get();
-            while (const auto& next = current->get_next())
+            const auto heap_size = m_heap.size();
+            m_heap.erase(std::remove_if(m_heap.begin(), m_heap.end(), is_disposed), m_heap.end());
+            if (m_heap.size() != heap_size && m_heap.size() > 1)
             {
-                if (schedulable->get_timepoint() < next->get_timepoint())
+                for (size_t index = (m_heap.size() - 2) / s_heap_arity + 1; index-- > 0;)
+                    heap_sift_down(index, std::move(m_heap[index]));
+            }
+
+            m_disposed_removal_threshold = std::max(s_min_disposed_removal_threshold, size() * 2);
+        }
+
+        bool is_fifo_empty() const { return m_fifo_head == m_fifo.size(); }
+
+        bool is_fifo_top() const
+        {
+            return !is_fifo_empty() && (m_heap.empty() || m_fifo[m_fifo_head] < m_heap.front());
+        }
+
+        schedulable_ptr fifo_pop()
+        {
+            auto res = std::move(m_fifo[m_fifo_head++].schedulable);
+            if (is_fifo_empty())
+            {
+                // keep capacity to avoid re-allocations
+                m_fifo.clear();
+                m_fifo_head = 0;
+            }
+            else if (m_fifo_head >= s_fifo_compaction_threshold && m_fifo_head * 2 >= m_fifo.size())
+            {
+                m_fifo.erase(m_fifo.begin(), m_fifo.begin() + static_cast<std::ptrdiff_t>(m_fifo_head));
+                m_fifo_head = 0;
+            }
+            return res;
+        }
+
+        void heap_push(entry&& e)
+        {
+            size_t index = m_heap.size();
+            m_heap.push_back(std::move(e));
+
+            auto value = std::move(m_heap[index]);
+            while (index > 0)
+            {
+                const size_t parent = (index - 1) / s_heap_arity;
+                if (!(value < m_heap[parent]))
                     break;
-                current = next.get();
+                m_heap[index] = std::move(m_heap[parent]);
+                index         = parent;
             }
+            m_heap[index] = std::move(value);
+        }
+
+        schedulable_ptr heap_pop()
+        {
+            auto res  = std::move(m_heap.front().schedulable);
+            auto last = std::move(m_heap.back());
+            m_heap.pop_back();
+
+            if (!m_heap.empty())
+                heap_sift_down(0, std::move(last));
+            return res;
+        }
 
-            current->update_next(std::move(schedulable));
+        void heap_sift_down(size_t index, entry value)
+        {
+            const size_t size = m_heap.size();
+            while (true)
+            {
+                const size_t first_child = index * s_heap_arity + 1;
+                if (first_child >= size)
+                    break;
+
+                size_t       min_child = first_child;
+                const size_t end       = std::min(first_child + s_heap_arity, size);
+                for (size_t child = first_child + 1; child < end; ++child)
+                {
+                    if (m_heap[child] < m_heap[min_child])
+                        min_child = child;
+                }
+
+                if (!(m_heap[min_child] < value))
+                    break;
+
+                m_heap[index] = std::move(m_heap[min_child]);
+                index         = min_child;
+            }
+            m_heap[index] = std::move(value);
         }
 
     private:
-        std::shared_ptr<schedulable_base> m_head{};
-        std::weak_ptr<shared_queue_data>  m_shared_data{};
+        std::vector<entry>               m_fifo{};
+        size_t                           m_fifo_head{};
+        std::vector<entry>               m_heap{};
+        size_t                           m_order{};
+        size_t                           m_disposed_removal_threshold{s_min_disposed_removal_threshold};
+        std::weak_ptr<shared_queue_data> m_shared_data{};
     };
 } // namespace rpp::schedulers::details
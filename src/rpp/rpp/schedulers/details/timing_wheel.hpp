@@ -0,0 +1,254 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2022 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <rpp/schedulers/details/queue.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <vector>
+
+namespace rpp::schedulers::details
+{
+    /**
+     * @brief Hierarchical timing wheel of schedulables.
+     *
+     * @details Time is split into ticks of fixed resolution. Schedulable is placed into the bucket of the lowest level which covers distance to its tick: level 0 has 64 buckets of 1 tick, level 1 has 64 buckets of 64 ticks and so on. Timers even further than last level are placed to the overflow bucket.
+     * When current tick reaches boundary of some level, bucket of this level is cascaded to the lower levels. Bitmap of occupied buckets per level is used to jump over empty ticks.
+     * Schedulables of the reached tick are expired as soon as their own time_point is reached, so schedulable is never expired earlier than its time_point. Schedulables of same tick are expired in order of insertion, not in order of exact time_point.
+     *
+     * Insertion is O(1), disposed schedulables are removed in one linear pass when size of wheel doubles since last removal (same as `schedulables_queue`).
+     *
+     * @warning Not thread-safe.
+     */
+    class timing_wheel
+    {
+        static constexpr size_t   s_bits_per_level                 = 6;
+        static constexpr size_t   s_levels_count                   = 4;
+        static constexpr size_t   s_slots_per_level                = size_t{1} << s_bits_per_level;
+        static constexpr uint64_t s_slot_mask                      = s_slots_per_level - 1;
+        static constexpr size_t   s_total_bits                     = s_bits_per_level * s_levels_count;
+        static constexpr size_t   s_min_disposed_removal_threshold = 64;
+
+        using bucket = std::vector<schedulable_ptr>;
+
+    public:
+        timing_wheel(duration resolution, time_point start)
+            : m_resolution{std::max(resolution, duration{1})}
+            , m_start{start}
+        {
+        }
+
+        void emplace(schedulable_ptr&& schedulable)
+        {
+            if (!schedulable)
+                return;
+
+            ++m_size;
+            insert(std::move(schedulable));
+
+            if (m_size >= m_disposed_removal_threshold)
+                remove_disposed();
+        }
+
+        bool is_empty() const { return m_size == 0; }
+
+        size_t size() const { return m_size; }
+
+        /**
+         * @brief Advances wheel to the provided time_point and moves all expired schedulables to `out`.
+         */
+        void advance(time_point now, std::vector<schedulable_ptr>& out)
+        {
+            const auto target = get_tick(now);
+            while (m_current_tick < target)
+            {
+                const auto next = get_next_tick();
+                if (!next || next.value() > target)
+                {
+                    m_current_tick = target;
+                    break;
+                }
+
+                m_current_tick = next.value();
+                process_current_tick();
+            }
+
+            // only schedulables of the current tick could be not reached yet
+            const auto not_reached = std::stable_partition(m_reached_ticks.begin(), m_reached_ticks.end(), [now](const schedulable_ptr& s) { return s->get_timepoint() <= now; });
+            m_size -= static_cast<size_t>(std::distance(m_reached_ticks.begin(), not_reached));
+            std::move(m_reached_ticks.begin(), not_reached, std::back_inserter(out));
+            m_reached_ticks.erase(m_reached_ticks.begin(), not_reached);
+        }
+
+        /**
+         * @brief Time_point when next schedulable could be expired or nullopt if wheel is empty.
+         */
+        std::optional<time_point> get_next_timepoint() const
+        {
+            if (!m_reached_ticks.empty())
+            {
+                return (*std::min_element(m_reached_ticks.begin(), m_reached_ticks.end(), [](const schedulable_ptr& l, const schedulable_ptr& r) {
+                           return l->get_timepoint() < r->get_timepoint();
+                       }))->get_timepoint();
+            }
+
+            if (const auto next = get_next_tick())
+                return m_start + static_cast<duration::rep>(next.value()) * m_resolution;
+            return std::nullopt;
+        }
+
+        /**
+         * @brief Removes all disposed schedulables from any position of the wheel.
+         */
+        void remove_disposed()
+        {
+            // destruction of schedulables is postponed till wheel is consistent again as it could lead to re-entrant emplace
+            std::vector<schedulable_ptr> disposed{};
+
+            const auto remove_from = [&disposed](bucket& b) {
+                b.erase(std::remove_if(b.begin(),
+                                       b.end(),
+                                       [&disposed](schedulable_ptr& s) {
+                                           if (!s->is_disposed())
+                                               return false;
+                                           disposed.push_back(std::move(s));
+                                           return true;
+                                       }),
+                        b.end());
+            };
+
+            for (size_t level = 0; level < s_levels_count; ++level)
+            {
+                for (size_t slot = 0; slot < s_slots_per_level; ++slot)
+                {
+                    if (!(m_occupied[level] & (uint64_t{1} << slot)))
+                        continue;
+
+                    remove_from(m_levels[level][slot]);
+                    if (m_levels[level][slot].empty())
+                        m_occupied[level] &= ~(uint64_t{1} << slot);
+                }
+            }
+            remove_from(m_overflow);
+            remove_from(m_reached_ticks);
+
+            m_size -= disposed.size();
+
+            m_disposed_removal_threshold = std::max(s_min_disposed_removal_threshold, m_size * 2);
+        }
+
+    private:
+        uint64_t get_tick(time_point timepoint) const
+        {
+            if (timepoint <= m_start)
+                return 0;
+            return static_cast<uint64_t>((timepoint - m_start) / m_resolution);
+        }
+
+        void insert(schedulable_ptr&& schedulable)
+        {
+            const auto tick = get_tick(schedulable->get_timepoint());
+            if (tick <= m_current_tick)
+            {
+                m_reached_ticks.push_back(std::move(schedulable));
+                return;
+            }
+
+            for (size_t level = 0; level < s_levels_count; ++level)
+            {
+                const auto upper_shift = s_bits_per_level * (level + 1);
+                if ((tick >> upper_shift) != (m_current_tick >> upper_shift))
+                    continue;
+
+                const auto slot = static_cast<size_t>((tick >> (s_bits_per_level * level)) & s_slot_mask);
+                m_levels[level][slot].push_back(std::move(schedulable));
+                m_occupied[level] |= uint64_t{1} << slot;
+                return;
+            }
+
+            m_overflow.push_back(std::move(schedulable));
+        }
+
+        std::optional<uint64_t> get_next_tick() const
+        {
+            for (size_t level = 0; level < s_levels_count; ++level)
+            {
+                const auto shift = s_bits_per_level * level;
+                const auto slot  = static_cast<size_t>((m_current_tick >> shift) & s_slot_mask);
+                // buckets of the current rotation are always after the current slot
+                const auto later = slot == s_slot_mask ? uint64_t{} : m_occupied[level] & (~uint64_t{} << (slot + 1));
+                if (later)
+                {
+                    const auto upper_shift = shift + s_bits_per_level;
+                    return ((m_current_tick >> upper_shift) << upper_shift) | (static_cast<uint64_t>(std::countr_zero(later)) << shift);
+                }
+            }
+
+            if (!m_overflow.empty())
+                return ((m_current_tick >> s_total_bits) + 1) << s_total_bits;
+            return std::nullopt;
+        }
+
+        void process_current_tick()
+        {
+            if ((m_current_tick & ((uint64_t{1} << s_total_bits) - 1)) == 0)
+                reinsert(std::exchange(m_overflow, bucket{}));
+
+            for (size_t level = s_levels_count - 1; level > 0; --level)
+            {
+                const auto shift = s_bits_per_level * level;
+                if ((m_current_tick & ((uint64_t{1} << shift) - 1)) != 0)
+                    continue;
+
+                const auto slot = static_cast<size_t>((m_current_tick >> shift) & s_slot_mask);
+                m_occupied[level] &= ~(uint64_t{1} << slot);
+                // cascaded schedulables are always placed to lower levels, so bucket can be re-used
+                reinsert(m_levels[level][slot]);
+            }
+
+            const auto slot = static_cast<size_t>(m_current_tick & s_slot_mask);
+            m_occupied[0] &= ~(uint64_t{1} << slot);
+            reinsert(m_levels[0][slot]);
+        }
+
+        void reinsert(bucket&& schedulables)
+        {
+            reinsert(schedulables);
+        }
+
+        void reinsert(bucket& schedulables)
+        {
+            for (auto& schedulable : schedulables)
+                insert(std::move(schedulable));
+            schedulables.clear();
+        }
+
+    private:
+        duration   m_resolution;
+        time_point m_start;
+        uint64_t   m_current_tick{};
+
+        std::array<std::array<bucket, s_slots_per_level>, s_levels_count> m_levels{};
+        std::array<uint64_t, s_levels_count>                               m_occupied{};
+        bucket                                                             m_overflow{};
+        // schedulables with tick not later than current one
+        bucket m_reached_ticks{};
+
+        size_t m_size{};
+        size_t m_disposed_removal_threshold{s_min_disposed_removal_threshold};
+    };
+} // namespace rpp::schedulers::details
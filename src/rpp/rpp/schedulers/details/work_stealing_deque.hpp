@@ -0,0 +1,147 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2022 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace rpp::schedulers::details
+{
+    /**
+     * @brief Chase-Lev work-stealing deque.
+     * @details Owner thread pushes and pops from the bottom (LIFO), any other thread can steal from the top (FIFO).
+     * Buffer grows on demand, previous buffers are kept till destruction of deque to keep concurrent `steal` safe.
+     *
+     * @warning `push` and `pop` must be called only from the owner thread, `steal` can be called from any thread.
+     */
+    template<typename T>
+        requires std::is_trivially_copyable_v<T>
+    class work_stealing_deque
+    {
+        class buffer
+        {
+        public:
+            explicit buffer(size_t capacity)
+                : m_capacity{capacity}
+                , m_data{std::make_unique<std::atomic<T>[]>(capacity)}
+            {
+            }
+
+            size_t capacity() const { return m_capacity; }
+
+            T load(int64_t index) const { return m_data[static_cast<size_t>(index) & (m_capacity - 1)].load(std::memory_order_relaxed); }
+
+            void store(int64_t index, T value) { m_data[static_cast<size_t>(index) & (m_capacity - 1)].store(value, std::memory_order_relaxed); }
+
+        private:
+            size_t                            m_capacity;
+            std::unique_ptr<std::atomic<T>[]> m_data;
+        };
+
+    public:
+        explicit work_stealing_deque(size_t capacity = 64)
+        {
+            size_t rounded = 1;
+            while (rounded < capacity)
+                rounded <<= 1;
+
+            m_buffers.push_back(std::make_unique<buffer>(rounded));
+            m_buffer.store(m_buffers.back().get(), std::memory_order_relaxed);
+        }
+
+        work_stealing_deque(const work_stealing_deque&) = delete;
+        work_stealing_deque(work_stealing_deque&&)      = delete;
+
+        void push(T value)
+        {
+            const auto b   = m_bottom.load(std::memory_order_relaxed);
+            const auto t   = m_top.load(std::memory_order_acquire);
+            auto*      buf = m_buffer.load(std::memory_order_relaxed);
+
+            if (b - t > static_cast<int64_t>(buf->capacity()) - 1)
+                buf = grow(buf, b, t);
+
+            buf->store(b, value);
+            // release store instead of release fence: same ordering, but visible to thread sanitizer
+            m_bottom.store(b + 1, std::memory_order_release);
+        }
+
+        std::optional<T> pop()
+        {
+            const auto b   = m_bottom.load(std::memory_order_relaxed) - 1;
+            auto*      buf = m_buffer.load(std::memory_order_relaxed);
+            m_bottom.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            auto t = m_top.load(std::memory_order_relaxed);
+
+            if (t > b)
+            {
+                m_bottom.store(b + 1, std::memory_order_relaxed);
+                return std::nullopt;
+            }
+
+            const auto value = buf->load(b);
+            if (t != b)
+                return value;
+
+            // last element: race against stealers
+            const bool won = m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            m_bottom.store(b + 1, std::memory_order_relaxed);
+            if (!won)
+                return std::nullopt;
+            return value;
+        }
+
+        std::optional<T> steal()
+        {
+            auto t = m_top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const auto b = m_bottom.load(std::memory_order_acquire);
+
+            if (t >= b)
+                return std::nullopt;
+
+            const auto value = m_buffer.load(std::memory_order_acquire)->load(t);
+            if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                return std::nullopt;
+            return value;
+        }
+
+        bool is_empty() const
+        {
+            const auto t = m_top.load(std::memory_order_acquire);
+            const auto b = m_bottom.load(std::memory_order_acquire);
+            return b <= t;
+        }
+
+    private:
+        buffer* grow(buffer* old, int64_t bottom, int64_t top)
+        {
+            auto new_buffer = std::make_unique<buffer>(old->capacity() * 2);
+            for (auto i = top; i != bottom; ++i)
+                new_buffer->store(i, old->load(i));
+
+            auto* raw = new_buffer.get();
+            m_buffers.push_back(std::move(new_buffer));
+            m_buffer.store(raw, std::memory_order_release);
+            return raw;
+        }
+
+    private:
+        alignas(64) std::atomic<int64_t>     m_top{};
+        alignas(64) std::atomic<int64_t>     m_bottom{};
+        std::atomic<buffer*>                 m_buffer{};
+        std::vector<std::unique_ptr<buffer>> m_buffers{};
+    };
+} // namespace rpp::schedulers::details
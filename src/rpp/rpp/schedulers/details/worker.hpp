@@ -14,13 +14,47 @@
 
 #include <rpp/defs.hpp>
 #include <rpp/disposables/disposable_wrapper.hpp>
+#include <rpp/schedulers/details/queue.hpp>
 #include <rpp/utils/constraints.hpp>
 
+#include <concepts>
+#include <exception>
+#include <utility>
+#include <vector>
+
+namespace rpp::schedulers::constraint
+{
+    /**
+     * @brief Strategy which is able to accept whole batch of already created schedulables at once (for example, under single lock and with single wake-up)
+     */
+    template<typename S>
+    concept batch_strategy = strategy<S> && requires(const S& s, std::vector<rpp::schedulers::details::schedulable_ptr>&& schedulables) {
+        {
+            s.defer_batch(std::move(schedulables))
+        } -> std::same_as<void>;
+    };
+
+    /**
+     * @brief Strategy which is able to say if the calling code is executed by this worker right now
+     */
+    template<typename S>
+    concept executor_identity_strategy = strategy<S> && requires(const S& s) {
+        {
+            s.is_current_executor()
+        } -> std::same_as<bool>;
+    };
+} // namespace rpp::schedulers::constraint
+
 namespace rpp::schedulers
 {
+    template<rpp::schedulers::constraint::strategy Strategy>
+    class worker_batch;
+
     template<rpp::schedulers::constraint::strategy Strategy>
     class worker
     {
+        friend class worker_batch<Strategy>;
+
     public:
         template<typename... Args>
             requires (!rpp::constraint::variadic_decayed_same_as<worker<Strategy>, Args...> && rpp::constraint::is_constructible_from<Strategy, Args && ...>)
@@ -56,9 +90,127 @@ namespace rpp::schedulers
                 schedule(tp - now(), std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
         }
 
+        /**
+         * @brief Schedules all schedulables scheduled via provided batch at once when `fn` returns.
+         *
+         * @details Strategies satisfying `rpp::schedulers::constraint::batch_strategy` receive whole batch at once (for example, `new_thread` and `run_loop` enqueue it under single synchronization and single wake-up), other strategies schedule each schedulable immediately as usual.
+         *
+         * @par Example
+         * @code{.cpp}
+         * worker.schedule_batch([&](auto& batch) {
+         *     for (int v : values)
+         *         batch.schedule([](const auto& obs, int v) { obs.on_next(v); return rpp::schedulers::optional_delay_from_now{}; }, obs, v);
+         * });
+         * @endcode
+         */
+        template<std::invocable<worker_batch<Strategy>&> Fn>
+        void schedule_batch(Fn&& fn) const
+        {
+            worker_batch<Strategy> batch{*this};
+            std::forward<Fn>(fn)(batch);
+        }
+
+        /**
+         * @brief Returns true if the calling code is executed by this worker right now (for example, inside thread of `new_thread` worker). Schedulable with zero delay scheduled in this case would be executed in the same thread anyway.
+         * @details Strategies without `is_current_executor()` are never treated as current executor.
+         */
+        bool is_current_executor() const
+        {
+            if constexpr (constraint::executor_identity_strategy<Strategy>)
+                return m_strategy.is_current_executor();
+            else
+                return false;
+        }
+
         static rpp::schedulers::time_point now() { return Strategy::now(); }
 
     private:
         RPP_NO_UNIQUE_ADDRESS Strategy m_strategy;
     };
+
+    /**
+     * @brief Scoped guard collecting schedulables to submit them to the worker at once on `submit()` or on destruction.
+     *
+     * @details In case of strategy not satisfying `rpp::schedulers::constraint::batch_strategy` schedulables are scheduled to the worker immediately one-by-one.
+     * @warning Batch should not outlive the worker it was created from.
+     */
+    template<rpp::schedulers::constraint::strategy Strategy>
+    class worker_batch
+    {
+    public:
+        explicit worker_batch(const worker<Strategy>& worker)
+            : m_worker{worker}
+        {
+        }
+
+        worker_batch(const worker_batch&) = delete;
+        worker_batch(worker_batch&&)      = delete;
+
+        /**
+         * @brief Submits collected schedulables. If submission fails, the error is forwarded to handlers of the schedulables that were not submitted.
+         */
+        ~worker_batch() noexcept
+        {
+            try
+            {
+                submit();
+            }
+            catch (...)
+            {
+                const auto err = std::current_exception();
+                for (const auto& schedulable : std::exchange(m_schedulables, {}))
+                {
+                    if (schedulable)
+                        schedulable->on_error(err);
+                }
+            }
+        }
+
+        template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+        void schedule(Fn&& fn, Handler&& handler, Args&&... args)
+        {
+            schedule(duration{}, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+        }
+
+        template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+        void schedule(const duration delay, Fn&& fn, Handler&& handler, Args&&... args)
+        {
+            if constexpr (constraint::batch_strategy<Strategy>)
+                schedule(m_worker.now() + delay, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            else
+                m_worker.schedule(delay, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+        }
+
+        template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+        void schedule(const time_point tp, Fn&& fn, Handler&& handler, Args&&... args)
+        {
+            if constexpr (constraint::batch_strategy<Strategy>)
+            {
+                if (!handler.is_disposed())
+                    m_schedulables.push_back(details::make_schedulable<Strategy>(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...));
+            }
+            else
+                m_worker.schedule(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Submits all collected schedulables to the worker. Batch can be used further after submit.
+         */
+        void submit()
+        {
+            if constexpr (constraint::batch_strategy<Strategy>)
+            {
+                if (m_schedulables.empty())
+                    return;
+
+                // schedulables not consumed by strategy in case of exception are kept to be able to notify their handlers
+                m_worker.m_strategy.defer_batch(std::move(m_schedulables));
+                m_schedulables.clear();
+            }
+        }
+
+    private:
+        const worker<Strategy>&               m_worker;
+        std::vector<details::schedulable_ptr> m_schedulables{};
+    };
 } // namespace rpp::schedulers
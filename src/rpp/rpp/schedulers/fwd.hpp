@@ -161,6 +161,8 @@ namespace rpp::schedulers
     class new_thread;
     class run_loop;
     class thread_pool;
+    class work_stealing_pool;
+    class timer_wheel;
     class computational;
 
     namespace defaults
@@ -193,8 +195,31 @@ namespace rpp::schedulers::constraint
             s.create_worker()
         } -> worker;
     };
+
+    template<typename O>
+    concept worker_observer = requires(O& o, duration d) {
+        o.on_enqueue();
+        o.on_dequeue(d);
+        o.on_executed(d);
+        o.on_dropped();
+    };
+
+    template<typename O>
+    concept scheduler_observer = requires(const O& o) {
+        {
+            o.create_worker_observer()
+        } -> worker_observer;
+    };
 } // namespace rpp::schedulers::constraint
 
+namespace rpp::schedulers
+{
+    template<constraint::scheduler Scheduler, constraint::scheduler_observer Observer>
+    class instrumented;
+
+    class scheduler_statistics;
+} // namespace rpp::schedulers
+
 namespace rpp::schedulers::utils
 {
     template<rpp::schedulers::constraint::scheduler Scheduler>
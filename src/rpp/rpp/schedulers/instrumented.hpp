@@ -0,0 +1,200 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <rpp/schedulers/details/worker.hpp>
+
+#include <algorithm>
+#include <concepts>
+#include <memory>
+#include <type_traits>
+
+namespace rpp::schedulers::details
+{
+    template<typename Worker>
+    struct worker_strategy_of;
+
+    template<typename Strategy>
+    struct worker_strategy_of<rpp::schedulers::worker<Strategy>>
+    {
+        using type = Strategy;
+    };
+
+    /**
+     * @brief Wraps original schedulable to report its lifetime to the worker observer: enqueue on scheduling/re-scheduling, dequeue with lag right before execution, execution with runtime of handler and drop in case of destruction without execution (for example, handler was disposed).
+     */
+    template<typename NowStrategy, typename Fn, typename WorkerObserver>
+    class instrumented_schedulable_fn
+    {
+    public:
+        template<rpp::constraint::decayed_same_as<Fn> TFn>
+        instrumented_schedulable_fn(TFn&& fn, std::shared_ptr<WorkerObserver> observer, time_point expected_timepoint)
+            : m_fn{std::forward<TFn>(fn)}
+            , m_observer{std::move(observer)}
+            , m_expected_timepoint{expected_timepoint}
+        {
+            m_observer->on_enqueue();
+        }
+
+        instrumented_schedulable_fn(const instrumented_schedulable_fn&) = delete;
+        instrumented_schedulable_fn(instrumented_schedulable_fn&&)      = default;
+
+        ~instrumented_schedulable_fn() noexcept
+        {
+            // moved-from instance has no observer
+            if (m_observer && m_is_pending)
+                m_observer->on_dropped();
+        }
+
+        template<typename... Args>
+        std::invoke_result_t<Fn&, Args&...> operator()(Args&... args)
+        {
+            const auto start = NowStrategy::now();
+            m_is_pending     = false;
+            m_observer->on_dequeue(std::max(duration{}, start - m_expected_timepoint));
+
+            std::invoke_result_t<Fn&, Args&...> result{};
+            try
+            {
+                result = m_fn(args...);
+            }
+            catch (...)
+            {
+                m_observer->on_executed(NowStrategy::now() - start);
+                throw;
+            }
+
+            const auto end = NowStrategy::now();
+            m_observer->on_executed(end - start);
+
+            if (result)
+            {
+                m_expected_timepoint = get_expected_timepoint(result.value(), end);
+                m_is_pending         = true;
+                m_observer->on_enqueue();
+            }
+            return result;
+        }
+
+    private:
+        static time_point get_expected_timepoint(const delay_from_now& delay, time_point end) { return end + delay.value; }
+        time_point        get_expected_timepoint(const delay_from_this_timepoint& delay, time_point) const { return m_expected_timepoint + delay.value; }
+        static time_point get_expected_timepoint(const delay_to& delay, time_point) { return delay.value; }
+
+    private:
+        RPP_NO_UNIQUE_ADDRESS Fn        m_fn;
+        std::shared_ptr<WorkerObserver> m_observer;
+        time_point                      m_expected_timepoint;
+        bool                            m_is_pending{true};
+    };
+
+    template<typename Strategy, typename WorkerObserver>
+    class instrumented_strategy
+    {
+        using original_worker = rpp::schedulers::worker<Strategy>;
+
+    public:
+        instrumented_strategy(original_worker&& worker, std::shared_ptr<WorkerObserver> observer)
+            : m_worker{std::move(worker)}
+            , m_observer{std::move(observer)}
+        {
+        }
+
+        template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            requires constraint::defer_for_strategy<Strategy>
+        void defer_for(duration duration, Fn&& fn, Handler&& handler, Args&&... args) const
+        {
+            m_worker.schedule(duration, wrap(now() + duration, std::forward<Fn>(fn)), std::forward<Handler>(handler), std::forward<Args>(args)...);
+        }
+
+        template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            requires constraint::defer_to_strategy<Strategy>
+        void defer_to(time_point tp, Fn&& fn, Handler&& handler, Args&&... args) const
+        {
+            m_worker.schedule(tp, wrap(tp, std::forward<Fn>(fn)), std::forward<Handler>(handler), std::forward<Args>(args)...);
+        }
+
+        bool is_current_executor() const { return m_worker.is_current_executor(); }
+
+        static rpp::schedulers::time_point now() { return original_worker::now(); }
+
+    private:
+        template<typename Fn>
+        auto wrap(time_point expected_timepoint, Fn&& fn) const
+        {
+            return instrumented_schedulable_fn<original_worker, std::decay_t<Fn>, WorkerObserver>{std::forward<Fn>(fn), m_observer, expected_timepoint};
+        }
+
+    private:
+        original_worker                 m_worker;
+        std::shared_ptr<WorkerObserver> m_observer;
+    };
+} // namespace rpp::schedulers::details
+
+namespace rpp::schedulers
+{
+    /**
+     * @brief Scheduler adapter which reports activity of workers of original scheduler to the provided observer.
+     *
+     * @details Each worker created by this scheduler wraps worker of original scheduler and gets own worker observer via `observer.create_worker_observer()`. Worker observer is notified about:
+     * - `on_enqueue()` - schedulable is scheduled or re-scheduled
+     * - `on_dequeue(lag)` - schedulable is going to be executed, `lag` is difference between actual and requested time_point of execution
+     * - `on_executed(runtime)` - schedulable is executed, `runtime` is duration of execution
+     * - `on_dropped()` - schedulable is destroyed without execution (for example, handler is disposed)
+     *
+     * Durations are measured via `now()` of original worker. Callbacks are invoked from the scheduling thread (enqueue) and from the executing thread (others), so worker observer should be thread-safe for schedulers with own threads.
+     * Instrumentation is fully opt-in: original schedulers are not changed and have no overhead when not wrapped.
+     *
+     * @par Example
+     * @code{.cpp}
+     * rpp::schedulers::scheduler_statistics statistics{};
+     * const auto scheduler = rpp::schedulers::instrumented{rpp::schedulers::thread_pool{4}, statistics};
+     * // ... somewhere in monitoring thread
+     * const auto snapshot = statistics.snapshot();
+     * @endcode
+     *
+     * @see rpp::schedulers::scheduler_statistics for ready-to-use observer
+     *
+     * @ingroup schedulers
+     */
+    template<constraint::scheduler Scheduler, constraint::scheduler_observer Observer>
+    class instrumented final
+    {
+        using original_worker = utils::get_worker_t<Scheduler>;
+        using worker_observer = std::decay_t<decltype(std::declval<const Observer&>().create_worker_observer())>;
+
+    public:
+        using worker_strategy = details::instrumented_strategy<typename details::worker_strategy_of<original_worker>::type, worker_observer>;
+
+        instrumented()
+            requires std::default_initializable<Scheduler> && std::default_initializable<Observer>
+        = default;
+
+        instrumented(Scheduler scheduler, Observer observer)
+            : m_scheduler{std::move(scheduler)}
+            , m_observer{std::move(observer)}
+        {
+        }
+
+        rpp::schedulers::worker<worker_strategy> create_worker() const
+        {
+            return rpp::schedulers::worker<worker_strategy>{m_scheduler.create_worker(), std::make_shared<worker_observer>(m_observer.create_worker_observer())};
+        }
+
+        const Observer& get_observer() const { return m_observer; }
+
+    private:
+        RPP_NO_UNIQUE_ADDRESS Scheduler m_scheduler;
+        RPP_NO_UNIQUE_ADDRESS Observer  m_observer;
+    };
+} // namespace rpp::schedulers
@@ -12,19 +12,53 @@
 
 #include <rpp/disposables/details/base_disposable.hpp>
 #include <rpp/schedulers/current_thread.hpp>
+#include <rpp/schedulers/details/inbox.hpp>
 
 #include <atomic>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <thread>
+#include <vector>
 
 namespace rpp::schedulers
 {
+    /**
+     * @brief Policy of waiting of `new_thread`/`thread_pool` thread when there is nothing to execute yet.
+     *
+     * @details Before parking on condition variable thread busy-spins `spin_count` iterations with CPU pause instruction and then yields `yield_count` times. Schedulables arrived during this phase are taken without any futex wake-up of the thread.
+     * Hot policy never parks thread and busy-spins till new schedulable or timer, so it expected to be used only with dedicated cores.
+     * On single core machine busy-spinning is replaced with yielding.
+     */
+    struct idle_policy
+    {
+        size_t spin_count{};
+        size_t yield_count{};
+        bool   is_hot{};
+
+        /**
+         * @brief Thread is parked immediately (default)
+         */
+        static constexpr idle_policy blocking() { return idle_policy{}; }
+
+        /**
+         * @brief Thread busy-spins and yields for bounded amount of iterations and only then is parked
+         */
+        static constexpr idle_policy spin_then_park(size_t spin_count = 4096, size_t yield_count = 64) { return idle_policy{spin_count, yield_count, false}; }
+
+        /**
+         * @brief Thread is never parked and always busy-spins
+         */
+        static constexpr idle_policy hot() { return idle_policy{0, 0, true}; }
+    };
+
     /**
      * @brief Scheduler which schedules invoking of schedulables to another thread via queueing tasks with priority to time_point and order
      * @warning Creates new thread for each "create_worker" call, but not for each schedule
      * @details This scheduler useful when we want to have separate thread for processing starting from some timepoint.
+     * Schedulables from other threads are pushed to the lock-free inbox of worker and thread is woken up only if it is actually parked, schedulables from the worker thread itself are placed to its queue directly.
+     * Waiting of thread for new schedulables can be configured via `rpp::schedulers::idle_policy`: `new_thread::create_worker(policy)` or `new_thread::with_idle_policy(policy)` to pass scheduler to operators.
      * @ingroup schedulers
      */
     class new_thread
@@ -32,7 +66,10 @@ namespace rpp::schedulers
         class state_t final
         {
         public:
-            state_t() = default;
+            explicit state_t(idle_policy policy = {})
+                : m_state{std::make_shared<queue_data>(policy)}
+            {
+            }
 
             ~state_t() noexcept
             {
@@ -41,7 +78,7 @@ namespace rpp::schedulers
 
                 {
                     std::lock_guard lock{m_state->mutex};
-                    m_state->is_stoping = true;
+                    m_state->is_stopping.store(true);
                 }
                 m_state->cv.notify_all();
                 m_thread.detach();
@@ -50,51 +87,158 @@ namespace rpp::schedulers
             template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
             void defer_to(time_point time_point, Fn&& fn, Handler&& handler, Args&&... args)
             {
-                m_state->queue.emplace(time_point, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
-                m_state->has_fresh_data.store(true);
+                // worker thread is the only consumer of its own queue, so it can emplace directly without any synchronization
+                if (is_current_executor())
+                {
+                    m_state->queue.emplace(time_point, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+                    return;
+                }
+
+                m_state->inbox.push(details::make_schedulable<current_thread::worker_strategy>(time_point, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...));
+                notify_if_parked();
+            }
+
+            void defer_batch(std::vector<details::schedulable_ptr>&& schedulables)
+            {
+                if (is_current_executor())
+                {
+                    for (auto& schedulable : schedulables)
+                    {
+                        const auto timepoint = schedulable->get_timepoint();
+                        m_state->queue.emplace(timepoint, std::move(schedulable));
+                    }
+                    return;
+                }
+
+                m_state->inbox.push(schedulables);
+                notify_if_parked();
+            }
+
+            bool is_current_executor() const
+            {
+                return current_thread::get_queue() == &m_state->queue;
+            }
+
+        private:
+            void notify_if_parked() const
+            {
+                // pairs with fence inside `park`: either we see parked consumer or consumer sees our schedulable
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (!m_state->is_parked.load(std::memory_order_relaxed))
+                    return;
+
+                {
+                    std::lock_guard lock{m_state->mutex};
+                }
+                m_state->cv.notify_one();
             }
 
         private:
-            struct queue_data : public details::shared_queue_data
+            struct queue_data
             {
+                explicit queue_data(idle_policy policy)
+                    : policy{policy}
+                {
+                }
+
+                const idle_policy                                            policy;
                 details::schedulables_queue<current_thread::worker_strategy> queue{};
-                bool                                                         is_stoping{};
-                std::atomic_bool                                             has_fresh_data{false};
+                details::schedulables_inbox                                  inbox{};
+                std::mutex                                                   mutex{};
+                std::condition_variable                                      cv{};
+                std::atomic_bool                                             is_parked{};
+                std::atomic_bool                                             is_stopping{};
+
+                bool has_fresh_data() const { return !queue.is_empty() || !inbox.is_empty(); }
+
+                void drain_inbox()
+                {
+                    inbox.drain([this](details::schedulable_ptr&& schedulable) {
+                        const auto timepoint = schedulable->get_timepoint();
+                        queue.emplace(timepoint, std::move(schedulable));
+                    });
+                }
+
+                void park(std::optional<time_point> deadline)
+                {
+                    if (spin(deadline))
+                        return;
+
+                    is_parked.store(true, std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    {
+                        std::unique_lock lock{mutex};
+                        // with pending timer we still need to wait for it even in case of stopping
+                        if (deadline)
+                            cv.wait_until(lock, deadline.value(), [&] { return !inbox.is_empty(); });
+                        else
+                            cv.wait(lock, [&] { return !inbox.is_empty() || is_stopping.load(); });
+                    }
+                    is_parked.store(false, std::memory_order_relaxed);
+                }
+
+                /**
+                 * @brief Busy-waits according to idle policy
+                 * @return true if waiting is finished and there is no need to park
+                 */
+                bool spin(std::optional<time_point> deadline) const
+                {
+                    // busy-spinning on single core just steals time from the producer, so yield instead
+                    static const bool s_can_spin = std::thread::hardware_concurrency() > 1;
+
+                    for (size_t i = 0;; ++i)
+                    {
+                        if (!inbox.is_empty() || (deadline ? clock_type::now() >= deadline.value() : is_stopping.load(std::memory_order_relaxed)))
+                            return true;
+
+                        if (policy.is_hot || i < policy.spin_count + policy.yield_count)
+                        {
+                            if (s_can_spin && (policy.is_hot || i < policy.spin_count))
+                                rpp::utils::cpu_relax();
+                            else
+                                std::this_thread::yield();
+                        }
+                        else
+                            return false;
+                    }
+                }
             };
 
             static void data_thread(std::shared_ptr<queue_data> state)
             {
-                current_thread::get_queue() = &state->queue;
+                auto& queue = state->queue;
+
+                current_thread::get_queue() = &queue;
 
                 while (true)
                 {
-                    std::unique_lock lock{state->mutex};
-                    if (state->queue.is_empty() && state->is_stoping)
-                        break;
+                    state->drain_inbox();
 
-                    state->cv.wait(lock, [&] { return !state->queue.is_empty() || state->is_stoping; });
+                    if (queue.is_empty())
+                    {
+                        if (state->is_stopping.load())
+                            break;
 
-                    if (state->queue.is_empty())
-                        break;
+                        state->park({});
+                        continue;
+                    }
 
-                    if (state->queue.top()->is_disposed())
+                    if (queue.top()->is_disposed())
                     {
-                        state->queue.pop();
+                        queue.pop();
                         continue;
                     }
 
-                    if (details::s_last_now_time < state->queue.top()->get_timepoint())
+                    if (details::s_last_now_time < queue.top()->get_timepoint())
                     {
-                        if (const auto now = worker_strategy::now(); now < state->queue.top()->get_timepoint())
+                        if (worker_strategy::now() < queue.top()->get_timepoint())
                         {
-                            state->cv.wait_for(lock, state->queue.top()->get_timepoint() - now, [&] { return state->queue.top()->is_disposed() || worker_strategy::now() >= state->queue.top()->get_timepoint(); });
+                            state->park(queue.top()->get_timepoint());
                             continue;
                         }
                     }
 
-                    auto top = state->queue.pop();
-                    state->has_fresh_data.store(!state->queue.is_empty());
-                    lock.unlock();
+                    auto top = queue.pop();
 
                     while (true)
                     {
@@ -102,11 +246,11 @@ namespace rpp::schedulers
                         {
                             if (!top->is_disposed())
                             {
-                                if (res->can_run_immediately() && !state->has_fresh_data.load())
+                                if (res->can_run_immediately() && !state->has_fresh_data())
                                     continue;
 
                                 const auto tp = top->handle_advanced_call(res.value());
-                                state->queue.emplace(tp, std::move(top));
+                                queue.emplace(tp, std::move(top));
                             }
                         }
                         break;
@@ -117,11 +261,8 @@ namespace rpp::schedulers
             }
 
         private:
-            std::shared_ptr<queue_data> m_state = std::make_shared<queue_data>();
-
-            RPP_CALL_DURING_CONSTRUCTION(m_state->queue = details::schedulables_queue<current_thread::worker_strategy>(m_state));
-
-            std::thread m_thread{&data_thread, m_state};
+            std::shared_ptr<queue_data> m_state;
+            std::thread                 m_thread{&data_thread, m_state};
         };
 
     public:
@@ -130,21 +271,61 @@ namespace rpp::schedulers
         public:
             worker_strategy() = default;
 
+            explicit worker_strategy(idle_policy policy)
+                : m_state{std::make_shared<state_t>(policy)}
+            {
+            }
+
             template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
             void defer_to(time_point tp, Fn&& fn, Handler&& handler, Args&&... args) const
             {
                 m_state->defer_to(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
             }
 
+            void defer_batch(std::vector<details::schedulable_ptr>&& schedulables) const
+            {
+                m_state->defer_batch(std::move(schedulables));
+            }
+
+            bool is_current_executor() const
+            {
+                return m_state->is_current_executor();
+            }
+
             static rpp::schedulers::time_point now() { return details::now(); }
 
         private:
             std::shared_ptr<state_t> m_state = std::make_shared<state_t>();
         };
 
-        static rpp::schedulers::worker<worker_strategy> create_worker()
+        /**
+         * @brief Scheduler creating `new_thread` workers with provided idle policy
+         */
+        class configured
+        {
+        public:
+            explicit configured(idle_policy policy)
+                : m_policy{policy}
+            {
+            }
+
+            rpp::schedulers::worker<worker_strategy> create_worker() const
+            {
+                return new_thread::create_worker(m_policy);
+            }
+
+        private:
+            idle_policy m_policy;
+        };
+
+        static rpp::schedulers::worker<worker_strategy> create_worker(idle_policy policy = {})
+        {
+            return rpp::schedulers::worker<worker_strategy>{policy};
+        }
+
+        static configured with_idle_policy(idle_policy policy)
         {
-            return rpp::schedulers::worker<worker_strategy>{};
+            return configured{policy};
         }
     };
 } // namespace rpp::schedulers
@@ -19,6 +19,8 @@
 #include <rpp/schedulers/details/worker.hpp>
 #include <rpp/utils/functors.hpp>
 
+#include <vector>
+
 namespace rpp::schedulers
 {
     /**
@@ -49,7 +51,23 @@ namespace rpp::schedulers
                 m_cv.notify_one();
             }
 
-            std::shared_ptr<details::schedulable_base> pop(bool wait)
+            void emplace_batch_and_notify(std::vector<details::schedulable_ptr>&& schedulables)
+            {
+                if (is_disposed())
+                    return;
+
+                {
+                    std::lock_guard lock{m_mutex};
+                    for (auto& schedulable : schedulables)
+                    {
+                        const auto timepoint = schedulable->get_timepoint();
+                        m_queue.emplace(timepoint, std::move(schedulable));
+                    }
+                }
+                m_cv.notify_all();
+            }
+
+            details::schedulable_ptr pop(bool wait)
             {
                 while (!is_disposed())
                 {
@@ -120,6 +138,12 @@ namespace rpp::schedulers
                     shared->emplace_and_notify(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
             }
 
+            void defer_batch(std::vector<details::schedulable_ptr>&& schedulables) const
+            {
+                if (const auto shared = m_state.lock())
+                    shared->emplace_batch_and_notify(std::move(schedulables));
+            }
+
             static rpp::schedulers::time_point now() { return details::now(); }
 
         private:
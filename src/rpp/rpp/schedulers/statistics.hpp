@@ -0,0 +1,320 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace rpp::schedulers
+{
+    /**
+     * @brief Lock-free histogram of durations with power-of-two buckets.
+     *
+     * @details Bucket `i` counts durations in range `[2^(i-1), 2^i)` nanoseconds (bucket 0 counts zero durations). Recording is few relaxed atomic increments, so it can be used from any amount of threads at the same time.
+     * Snapshot can be taken from any thread at any time, but it is not atomic as a whole: values recorded during snapshot may be partially visible.
+     *
+     * @ingroup schedulers
+     */
+    class latency_histogram final
+    {
+    public:
+        static constexpr size_t buckets_count = 64;
+
+        struct snapshot_t
+        {
+            uint64_t                              count{};
+            duration                              sum{};
+            duration                              max{};
+            std::array<uint64_t, buckets_count> buckets{};
+
+            duration mean() const { return count == 0 ? duration{} : sum / static_cast<duration::rep>(count); }
+
+            /**
+             * @brief Upper bound of the bucket containing provided percentile (in range [0;1])
+             */
+            duration percentile(double p) const
+            {
+                uint64_t total{};
+                for (const auto v : buckets)
+                    total += v;
+                if (total == 0)
+                    return duration{};
+
+                const auto target = std::max(uint64_t{1}, static_cast<uint64_t>(std::ceil(std::clamp(p, 0.0, 1.0) * static_cast<double>(total))));
+
+                uint64_t accumulated{};
+                for (size_t i = 0; i < buckets_count; ++i)
+                {
+                    accumulated += buckets[i];
+                    if (accumulated >= target)
+                        return std::min(max, bucket_upper_bound(i));
+                }
+                return max;
+            }
+
+            static duration bucket_upper_bound(size_t index)
+            {
+                return duration{static_cast<duration::rep>((uint64_t{1} << index) - 1)};
+            }
+        };
+
+        latency_histogram() = default;
+
+        latency_histogram(const latency_histogram&) = delete;
+        latency_histogram(latency_histogram&&)      = delete;
+
+        void record(duration value) noexcept
+        {
+            const auto ns = static_cast<uint64_t>(std::max(value.count(), duration::rep{}));
+
+            m_buckets[static_cast<size_t>(std::bit_width(ns))].fetch_add(1, std::memory_order_relaxed);
+            m_count.fetch_add(1, std::memory_order_relaxed);
+            m_sum.fetch_add(ns, std::memory_order_relaxed);
+
+            auto max = m_max.load(std::memory_order_relaxed);
+            while (max < ns && !m_max.compare_exchange_weak(max, ns, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        snapshot_t snapshot() const noexcept
+        {
+            snapshot_t result{};
+            result.count = m_count.load(std::memory_order_relaxed);
+            result.sum   = duration{static_cast<duration::rep>(m_sum.load(std::memory_order_relaxed))};
+            result.max   = duration{static_cast<duration::rep>(m_max.load(std::memory_order_relaxed))};
+            for (size_t i = 0; i < buckets_count; ++i)
+                result.buckets[i] = m_buckets[i].load(std::memory_order_relaxed);
+            return result;
+        }
+
+    private:
+        std::array<std::atomic<uint64_t>, buckets_count> m_buckets{};
+        std::atomic<uint64_t>                            m_count{};
+        std::atomic<uint64_t>                            m_sum{};
+        std::atomic<uint64_t>                            m_max{};
+    };
+
+    /**
+     * @brief Ready-to-use observer for `rpp::schedulers::instrumented` scheduler collecting queue depth, dispatch lag and handler runtime histograms and per-worker utilization.
+     *
+     * @details Instances are cheap to copy: all copies share same statistics. Per-worker counters are updated without any locks, mutex is used only during creation of worker and during snapshot.
+     * Statistics of destroyed workers are still counted in totals.
+     *
+     * @par Example
+     * @code{.cpp}
+     * rpp::schedulers::scheduler_statistics statistics{};
+     * rpp::source::interval(std::chrono::milliseconds{1}, rpp::schedulers::instrumented{rpp::schedulers::new_thread{}, statistics}) | ...;
+     *
+     * const auto snapshot = statistics.snapshot();
+     * std::cout << snapshot.queue_depth() << " " << snapshot.lag.percentile(0.99).count() << std::endl;
+     * @endcode
+     *
+     * @ingroup schedulers
+     */
+    class scheduler_statistics final
+    {
+        struct totals_t
+        {
+            uint64_t enqueued{};
+            uint64_t dequeued{};
+            uint64_t dropped{};
+        };
+
+        struct state_t;
+
+        struct worker_counters
+        {
+            worker_counters(std::shared_ptr<state_t> state, size_t id)
+                : state{std::move(state)}
+                , id{id}
+            {
+            }
+
+            worker_counters(const worker_counters&) = delete;
+            worker_counters(worker_counters&&)      = delete;
+
+            ~worker_counters() noexcept
+            {
+                std::lock_guard lock{state->mutex};
+                state->finished.enqueued += enqueued.load(std::memory_order_relaxed);
+                state->finished.dequeued += dequeued.load(std::memory_order_relaxed);
+                state->finished.dropped += dropped.load(std::memory_order_relaxed);
+            }
+
+            std::shared_ptr<state_t> state;
+            size_t                   id;
+            time_point               created = clock_type::now();
+
+            std::atomic<uint64_t> enqueued{};
+            std::atomic<uint64_t> dequeued{};
+            std::atomic<uint64_t> dropped{};
+            std::atomic<uint64_t> busy_ns{};
+        };
+
+        struct state_t
+        {
+            static constexpr size_t s_min_prune_threshold = 64;
+
+            latency_histogram lag{};
+            latency_histogram runtime{};
+
+            std::mutex                                  mutex{};
+            std::vector<std::weak_ptr<worker_counters>> workers{};
+            size_t                                      prune_threshold{s_min_prune_threshold};
+            size_t                                      next_id{};
+            totals_t                                    finished{};
+
+            void prune_unsafe()
+            {
+                workers.erase(std::remove_if(workers.begin(), workers.end(), [](const auto& w) { return w.expired(); }), workers.end());
+                prune_threshold = std::max(s_min_prune_threshold, workers.size() * 2);
+            }
+        };
+
+    public:
+        class worker_observer
+        {
+        public:
+            explicit worker_observer(std::shared_ptr<worker_counters> counters)
+                : m_counters{std::move(counters)}
+            {
+            }
+
+            void on_enqueue() const { m_counters->enqueued.fetch_add(1, std::memory_order_relaxed); }
+
+            void on_dequeue(duration lag) const
+            {
+                m_counters->dequeued.fetch_add(1, std::memory_order_relaxed);
+                m_counters->state->lag.record(lag);
+            }
+
+            void on_executed(duration runtime) const
+            {
+                m_counters->busy_ns.fetch_add(static_cast<uint64_t>(std::max(runtime.count(), duration::rep{})), std::memory_order_relaxed);
+                m_counters->state->runtime.record(runtime);
+            }
+
+            void on_dropped() const
+            {
+                m_counters->dequeued.fetch_add(1, std::memory_order_relaxed);
+                m_counters->dropped.fetch_add(1, std::memory_order_relaxed);
+            }
+
+        private:
+            std::shared_ptr<worker_counters> m_counters;
+        };
+
+        struct worker_snapshot
+        {
+            size_t   id{};
+            size_t   queue_depth{};
+            uint64_t executed{};
+            duration busy{};
+            duration lifetime{};
+
+            /**
+             * @brief Part of worker's lifetime spent in execution of schedulables (in range [0;1])
+             */
+            double utilization() const { return lifetime <= duration{} ? 0.0 : std::min(1.0, static_cast<double>(busy.count()) / static_cast<double>(lifetime.count())); }
+        };
+
+        struct snapshot_t
+        {
+            uint64_t enqueued{};
+            uint64_t dequeued{};
+            uint64_t dropped{};
+
+            latency_histogram::snapshot_t lag{};
+            latency_histogram::snapshot_t runtime{};
+
+            std::vector<worker_snapshot> workers{};
+
+            /**
+             * @brief Amount of schedulables scheduled but not executed or dropped yet
+             */
+            size_t queue_depth() const { return enqueued > dequeued ? static_cast<size_t>(enqueued - dequeued) : 0; }
+        };
+
+        scheduler_statistics()
+            : m_state{std::make_shared<state_t>()}
+        {
+        }
+
+        worker_observer create_worker_observer() const
+        {
+            std::lock_guard lock{m_state->mutex};
+            if (m_state->workers.size() >= m_state->prune_threshold)
+                m_state->prune_unsafe();
+
+            auto counters = std::make_shared<worker_counters>(m_state, m_state->next_id++);
+            m_state->workers.push_back(counters);
+            return worker_observer{std::move(counters)};
+        }
+
+        snapshot_t snapshot() const
+        {
+            const auto now = clock_type::now();
+
+            snapshot_t result{};
+            result.lag     = m_state->lag.snapshot();
+            result.runtime = m_state->runtime.snapshot();
+
+            std::vector<std::shared_ptr<worker_counters>> alive{};
+            {
+                std::lock_guard lock{m_state->mutex};
+                m_state->prune_unsafe();
+
+                result.enqueued = m_state->finished.enqueued;
+                result.dequeued = m_state->finished.dequeued;
+                result.dropped  = m_state->finished.dropped;
+
+                alive.reserve(m_state->workers.size());
+                for (const auto& w : m_state->workers)
+                {
+                    if (auto counters = w.lock())
+                        alive.push_back(std::move(counters));
+                }
+            }
+
+            result.workers.reserve(alive.size());
+            for (const auto& counters : alive)
+            {
+                const auto enqueued = counters->enqueued.load(std::memory_order_relaxed);
+                const auto dequeued = counters->dequeued.load(std::memory_order_relaxed);
+                const auto dropped  = counters->dropped.load(std::memory_order_relaxed);
+
+                result.enqueued += enqueued;
+                result.dequeued += dequeued;
+                result.dropped += dropped;
+
+                result.workers.push_back(worker_snapshot{.id          = counters->id,
+                                                         .queue_depth = enqueued > dequeued ? static_cast<size_t>(enqueued - dequeued) : 0,
+                                                         .executed    = dequeued - dropped,
+                                                         .busy        = duration{static_cast<duration::rep>(counters->busy_ns.load(std::memory_order_relaxed))},
+                                                         .lifetime    = now - counters->created});
+            }
+            return result;
+        }
+
+    private:
+        std::shared_ptr<state_t> m_state;
+    };
+} // namespace rpp::schedulers
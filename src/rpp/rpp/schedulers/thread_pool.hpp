@@ -21,6 +21,7 @@ namespace rpp::schedulers
     /**
      * @brief Scheduler owning static thread pool of workers and using "some" thread from this pool on `create_worker` call
      * @warning Expected to use this scheduler as local variable to share same threads between different operators or as static variable
+     * @details Waiting of pool threads for new schedulables can be configured via `rpp::schedulers::idle_policy`
      *
      * @par Examples
      * @snippet thread_pool.cpp thread_pool
@@ -51,6 +52,11 @@ namespace rpp::schedulers
                 m_original_worker.schedule(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
             }
 
+            bool is_current_executor() const
+            {
+                return m_original_worker.is_current_executor();
+            }
+
             static rpp::schedulers::time_point now() { return original_worker::now(); }
 
         private:
@@ -58,8 +64,8 @@ namespace rpp::schedulers
         };
 
     public:
-        explicit thread_pool(size_t threads_count = std::thread::hardware_concurrency())
-            : m_state{std::make_shared<state>(threads_count)}
+        explicit thread_pool(size_t threads_count = std::thread::hardware_concurrency(), idle_policy policy = {})
+            : m_state{std::make_shared<state>(threads_count, policy)}
         {
         }
 
@@ -72,12 +78,12 @@ namespace rpp::schedulers
         class state
         {
         public:
-            explicit state(size_t threads_count)
+            state(size_t threads_count, idle_policy policy)
             {
                 threads_count = std::max(size_t{1}, threads_count);
                 m_workers.reserve(threads_count);
                 for (size_t i = 0; i < threads_count; ++i)
-                    m_workers.emplace_back(new_thread::create_worker());
+                    m_workers.emplace_back(new_thread::create_worker(policy));
             }
 
             const original_worker& get() { return m_workers[m_index++ % m_workers.size()]; }
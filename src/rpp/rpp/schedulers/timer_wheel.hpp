@@ -0,0 +1,258 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <rpp/schedulers/details/queue.hpp>
+#include <rpp/schedulers/details/timing_wheel.hpp>
+#include <rpp/schedulers/details/utils.hpp>
+#include <rpp/schedulers/details/worker.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace rpp::schedulers
+{
+    /**
+     * @brief Scheduler which keeps schedulables inside of hierarchical timing wheel instead of sorted queue. Designed for huge amount of concurrent timers (for example, per-connection timeouts), where O(1) insertion matters more than exact ordering.
+     *
+     * @details Time is split into ticks of provided resolution: schedulable is executed at the first tick not earlier than its time_point, schedulables expired at same tick are not ordered by their exact time_point.
+     * Disposed schedulables are periodically removed from the wheel without waiting for their time_point.
+     *
+     * Scheduler can be driven in two ways:
+     * - `mode::own_thread` - (default) wheel is driven by the own thread which sleeps till next non-empty tick
+     * - `mode::manual_dispatch` - wheel is driven manually via `dispatch`/`dispatch_if_ready` similar to `run_loop`
+     *
+     * @warning All workers of same scheduler share same wheel and same thread
+     *
+     * @ingroup schedulers
+     */
+    class timer_wheel final
+    {
+        class state_t final
+        {
+        public:
+            explicit state_t(duration resolution)
+                : m_wheel{resolution, details::now()}
+            {
+            }
+
+            void emplace(time_point timepoint, details::schedulable_ptr&& schedulable)
+            {
+                schedulable->set_timepoint(timepoint);
+                emplace(std::move(schedulable));
+            }
+
+            void emplace(details::schedulable_ptr&& schedulable)
+            {
+                const auto timepoint = schedulable->get_timepoint();
+
+                std::unique_lock lock{m_mutex};
+                m_wheel.emplace(std::move(schedulable));
+
+                // no need to wake up waiting thread if it is going to wake up earlier anyway
+                if (!m_is_waiting || (m_wake_up_timepoint && m_wake_up_timepoint.value() <= timepoint))
+                    return;
+
+                m_wake_up_timepoint = timepoint;
+                lock.unlock();
+                m_cv.notify_one();
+            }
+
+            /**
+             * @brief Moves expired schedulables to `out`. In case of `wait` waits till any schedulable is expired.
+             * @return false if state is stopped and there is nothing to execute anymore
+             */
+            bool pop_expired(std::vector<details::schedulable_ptr>& out, bool wait)
+            {
+                std::unique_lock lock{m_mutex};
+                while (true)
+                {
+                    m_wheel.advance(details::now(), out);
+                    if (!out.empty() || !wait)
+                        return true;
+
+                    if (m_is_stopping)
+                    {
+                        // nobody can schedule anything new, so no need to wait for disposed ones
+                        m_wheel.remove_disposed();
+                        if (m_wheel.is_empty())
+                            return false;
+                    }
+
+                    m_wake_up_timepoint = m_wheel.get_next_timepoint();
+                    m_is_waiting        = true;
+                    if (m_wake_up_timepoint)
+                        m_cv.wait_until(lock, m_wake_up_timepoint.value());
+                    else
+                        m_cv.wait(lock);
+                    m_is_waiting = false;
+                }
+            }
+
+            void execute(std::vector<details::schedulable_ptr>& schedulables)
+            {
+                for (auto& schedulable : schedulables)
+                {
+                    if (schedulable->is_disposed())
+                        continue;
+
+                    if (const auto timepoint = (*schedulable)())
+                    {
+                        if (!schedulable->is_disposed())
+                            emplace(timepoint.value(), std::move(schedulable));
+                    }
+                }
+                schedulables.clear();
+            }
+
+            bool is_empty() const
+            {
+                std::lock_guard lock{m_mutex};
+                return m_wheel.is_empty();
+            }
+
+            void stop()
+            {
+                {
+                    std::lock_guard lock{m_mutex};
+                    m_is_stopping = true;
+                }
+                m_cv.notify_all();
+            }
+
+        private:
+            mutable std::mutex        m_mutex{};
+            std::condition_variable   m_cv{};
+            details::timing_wheel     m_wheel;
+            std::optional<time_point> m_wake_up_timepoint{};
+            bool                      m_is_waiting{};
+            bool                      m_is_stopping{};
+        };
+
+        class handle_t final
+        {
+        public:
+            handle_t(duration resolution, bool own_thread)
+                : m_state{std::make_shared<state_t>(resolution)}
+            {
+                if (own_thread)
+                    m_thread = std::thread{&run, m_state};
+            }
+
+            handle_t(const handle_t&) = delete;
+            handle_t(handle_t&&)      = delete;
+
+            ~handle_t() noexcept
+            {
+                if (!m_thread.joinable())
+                    return;
+
+                m_state->stop();
+                m_thread.detach();
+            }
+
+            state_t& get_state() const { return *m_state; }
+
+        private:
+            static void run(std::shared_ptr<state_t> state)
+            {
+                std::vector<details::schedulable_ptr> expired{};
+                while (state->pop_expired(expired, true))
+                    state->execute(expired);
+            }
+
+        private:
+            std::shared_ptr<state_t> m_state;
+            std::thread              m_thread{};
+        };
+
+    public:
+        enum class mode
+        {
+            own_thread,
+            manual_dispatch
+        };
+
+        class worker_strategy
+        {
+        public:
+            explicit worker_strategy(const std::shared_ptr<handle_t>& handle)
+                : m_handle{handle}
+            {
+            }
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_to(time_point tp, Fn&& fn, Handler&& handler, Args&&... args) const
+            {
+                if (handler.is_disposed())
+                    return;
+
+                m_handle->get_state().emplace(details::make_schedulable<worker_strategy>(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...));
+            }
+
+            static rpp::schedulers::time_point now() { return details::now(); }
+
+        private:
+            std::shared_ptr<handle_t> m_handle;
+        };
+
+        explicit timer_wheel(duration resolution = std::chrono::milliseconds{1}, mode drive_mode = mode::own_thread)
+            : m_handle{std::make_shared<handle_t>(resolution, drive_mode == mode::own_thread)}
+        {
+        }
+
+        bool is_empty() const
+        {
+            return m_handle->get_state().is_empty();
+        }
+
+        /**
+         * @brief Executes all already expired schedulables
+         * @warning Expected to be used only with `mode::manual_dispatch`
+         */
+        void dispatch_if_ready() const
+        {
+            dispatch_impl(false);
+        }
+
+        /**
+         * @brief Waits till any schedulable is expired and executes all expired schedulables
+         * @warning Expected to be used only with `mode::manual_dispatch`
+         */
+        void dispatch() const
+        {
+            dispatch_impl(true);
+        }
+
+        rpp::schedulers::worker<worker_strategy> create_worker() const
+        {
+            return rpp::schedulers::worker<worker_strategy>{m_handle};
+        }
+
+    private:
+        void dispatch_impl(bool wait) const
+        {
+            std::vector<details::schedulable_ptr> expired{};
+            if (m_handle->get_state().pop_expired(expired, wait))
+                m_handle->get_state().execute(expired);
+        }
+
+    private:
+        std::shared_ptr<handle_t> m_handle;
+    };
+} // namespace rpp::schedulers
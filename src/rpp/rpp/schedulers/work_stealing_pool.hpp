@@ -0,0 +1,398 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+
+#include <rpp/schedulers/current_thread.hpp>
+#include <rpp/schedulers/details/queue.hpp>
+#include <rpp/schedulers/details/utils.hpp>
+#include <rpp/schedulers/details/work_stealing_deque.hpp>
+#include <rpp/schedulers/details/worker.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace rpp::schedulers
+{
+    /**
+     * @brief Scheduler owning pool of threads where workers are not pinned to any thread: idle threads steal pending workers from busy ones.
+     *
+     * @details Each worker keeps its own queue of schedulables and is executed by at most one thread at a time, so schedulables of same worker are still executed serially and in order.
+     * Worker with ready schedulables is pushed to the Chase-Lev deque of current pool thread (or to the shared injection queue if scheduling happens outside of the pool). Threads take workers from own deque first, then from injection queue and then steal from deques of other threads.
+     * After some amount of executed schedulables worker is re-queued to the injection queue to give a chance for other workers.
+     * When scheduler and all of its workers are destroyed, threads finish already ready schedulables and are joined, while schedulables still waiting for their time are dropped.
+     *
+     * @warning Compared to `thread_pool` same worker can be executed on different threads of the pool over time (but never concurrently)
+     * @warning Expected to use this scheduler as local variable to share same threads between different operators or as static variable
+     *
+     * @ingroup schedulers
+     */
+    class work_stealing_pool final
+    {
+        class pool_state;
+
+        class worker_state final : public std::enable_shared_from_this<worker_state>
+        {
+        public:
+            explicit worker_state(std::shared_ptr<pool_state> pool)
+                : m_pool{std::move(pool)}
+            {
+            }
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_to(time_point time_point, Fn&& fn, Handler&& handler, Args&&... args)
+            {
+                if (handler.is_disposed())
+                    return;
+
+                std::unique_lock lock{m_data->mutex};
+                m_queue.emplace(time_point, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+                if (m_is_scheduled)
+                    return;
+
+                m_is_scheduled = true;
+                m_self         = shared_from_this();
+                lock.unlock();
+
+                m_pool->submit(this);
+            }
+
+            void wake_up(time_point timer_timepoint, std::shared_ptr<worker_state> self)
+            {
+                {
+                    std::lock_guard lock{m_data->mutex};
+                    if (m_timer_timepoint == timer_timepoint)
+                        m_timer_timepoint.reset();
+
+                    if (m_is_scheduled)
+                        return;
+
+                    m_is_scheduled = true;
+                    m_self         = std::move(self);
+                }
+                m_pool->submit(this);
+            }
+
+            bool is_current_executor() const
+            {
+                return current_thread::get_queue() == &m_queue;
+            }
+
+            void drain()
+            {
+                static constexpr size_t s_max_executions_in_row = 64;
+
+                current_thread::get_queue() = &m_queue;
+
+                std::unique_lock lock{m_data->mutex};
+                for (size_t executed = 0; !m_queue.is_empty(); ++executed)
+                {
+                    if (m_queue.top()->is_disposed())
+                    {
+                        m_queue.pop();
+                        continue;
+                    }
+
+                    if (const auto tp = m_queue.top()->get_timepoint(); tp > worker_strategy::now())
+                    {
+                        // no need to register one more timer if some earlier one is still pending
+                        if (!m_timer_timepoint || tp < m_timer_timepoint.value())
+                        {
+                            m_timer_timepoint = tp;
+                            m_pool->add_timer(tp, shared_from_this());
+                        }
+                        break;
+                    }
+
+                    if (executed == s_max_executions_in_row)
+                    {
+                        lock.unlock();
+                        current_thread::get_queue() = nullptr;
+                        m_pool->submit(this, true);
+                        return;
+                    }
+
+                    auto top = m_queue.pop();
+                    lock.unlock();
+
+                    if (const auto timepoint = (*top)())
+                    {
+                        if (!top->is_disposed())
+                            m_queue.emplace(timepoint.value(), std::move(top));
+                    }
+
+                    lock.lock();
+                }
+
+                current_thread::get_queue() = nullptr;
+
+                m_is_scheduled  = false;
+                const auto self = std::move(m_self);
+                lock.unlock();
+            }
+
+        private:
+            std::shared_ptr<pool_state>                                  m_pool;
+            std::shared_ptr<details::shared_queue_data>                  m_data = std::make_shared<details::shared_queue_data>();
+            details::schedulables_queue<current_thread::worker_strategy> m_queue{m_data};
+            std::shared_ptr<worker_state>                                m_self{};
+            std::optional<time_point>                                    m_timer_timepoint{};
+            bool                                                         m_is_scheduled{};
+        };
+
+        class pool_state final
+        {
+            struct timer
+            {
+                time_point                    timepoint;
+                std::shared_ptr<worker_state> worker;
+
+                bool operator<(const timer& other) const { return timepoint > other.timepoint; }
+            };
+
+            struct current_thread_info
+            {
+                const pool_state* pool{};
+                size_t            index{};
+            };
+
+            static current_thread_info& get_current_thread_info()
+            {
+                thread_local current_thread_info s_info{};
+                return s_info;
+            }
+
+        public:
+            explicit pool_state(size_t threads_count)
+                : m_deques(threads_count)
+            {
+                for (auto& deque : m_deques)
+                    deque = std::make_unique<details::work_stealing_deque<worker_state*>>();
+            }
+
+            size_t threads_count() const { return m_deques.size(); }
+
+            void submit(worker_state* worker, bool to_injection_queue = false)
+            {
+                const auto& info = get_current_thread_info();
+                if (!to_injection_queue && info.pool == this)
+                {
+                    m_deques[info.index]->push(worker);
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    if (m_sleeping_count.load(std::memory_order_relaxed) == 0)
+                        return;
+                    std::lock_guard lock{m_mutex};
+                }
+                else
+                {
+                    std::lock_guard lock{m_mutex};
+                    m_injection_queue.push_back(worker);
+                }
+                m_cv.notify_one();
+            }
+
+            void add_timer(time_point timepoint, std::shared_ptr<worker_state> worker)
+            {
+                {
+                    std::lock_guard lock{m_mutex};
+                    // same as in `stop()`: worker is released outside of lock
+                    if (m_is_stopping)
+                        return;
+
+                    m_timers.push_back(timer{timepoint, std::move(worker)});
+                    std::push_heap(m_timers.begin(), m_timers.end());
+                }
+                m_cv.notify_one();
+            }
+
+            void stop()
+            {
+                // nobody is able to schedule anything to pool anymore, so pending timers are never waited for: threads exit as soon as already ready work is done
+                std::vector<timer> timers{};
+                {
+                    std::lock_guard lock{m_mutex};
+                    m_is_stopping = true;
+                    timers.swap(m_timers);
+                }
+                m_cv.notify_all();
+            }
+
+            static void run(std::shared_ptr<pool_state> state, size_t index)
+            {
+                get_current_thread_info() = current_thread_info{state.get(), index};
+
+                while (auto* worker = state->get_next_worker(index))
+                    worker->drain();
+
+                get_current_thread_info() = current_thread_info{};
+            }
+
+        private:
+            worker_state* get_next_worker(size_t index)
+            {
+                while (true)
+                {
+                    if (const auto local = m_deques[index]->pop())
+                        return local.value();
+
+                    if (auto* stolen = steal(index))
+                        return stolen;
+
+                    std::unique_lock lock{m_mutex};
+                    wake_up_expired_timers_unsafe(lock);
+
+                    if (!m_injection_queue.empty())
+                    {
+                        auto* worker = m_injection_queue.front();
+                        m_injection_queue.pop_front();
+                        return worker;
+                    }
+
+                    if (m_is_stopping && m_timers.empty() && std::all_of(m_deques.begin(), m_deques.end(), [](const auto& d) { return d->is_empty(); }))
+                        return nullptr;
+
+                    m_sleeping_count.fetch_add(1, std::memory_order_seq_cst);
+                    if (std::any_of(m_deques.begin(), m_deques.end(), [](const auto& d) { return !d->is_empty(); }))
+                    {
+                        m_sleeping_count.fetch_sub(1, std::memory_order_relaxed);
+                        continue;
+                    }
+
+                    if (m_timers.empty())
+                        m_cv.wait(lock);
+                    else
+                        m_cv.wait_until(lock, m_timers.front().timepoint);
+
+                    m_sleeping_count.fetch_sub(1, std::memory_order_relaxed);
+                }
+            }
+
+            worker_state* steal(size_t index) const
+            {
+                for (size_t i = 1; i < m_deques.size(); ++i)
+                {
+                    if (const auto stolen = m_deques[(index + i) % m_deques.size()]->steal())
+                        return stolen.value();
+                }
+                return nullptr;
+            }
+
+            void wake_up_expired_timers_unsafe(std::unique_lock<std::mutex>& lock)
+            {
+                const auto now = worker_strategy::now();
+                while (!m_timers.empty() && m_timers.front().timepoint <= now)
+                {
+                    std::pop_heap(m_timers.begin(), m_timers.end());
+                    auto expired = std::move(m_timers.back());
+                    m_timers.pop_back();
+
+                    lock.unlock();
+                    auto* worker = expired.worker.get();
+                    worker->wake_up(expired.timepoint, std::move(expired.worker));
+                    lock.lock();
+                }
+            }
+
+        private:
+            std::vector<std::unique_ptr<details::work_stealing_deque<worker_state*>>> m_deques;
+
+            std::mutex                m_mutex{};
+            std::condition_variable   m_cv{};
+            std::deque<worker_state*> m_injection_queue{};
+            std::vector<timer>        m_timers{};
+            std::atomic<size_t>       m_sleeping_count{};
+            bool                      m_is_stopping{};
+        };
+
+        class pool_handle final
+        {
+        public:
+            explicit pool_handle(size_t threads_count)
+                : m_state{std::make_shared<pool_state>(std::max(size_t{1}, threads_count))}
+            {
+                m_threads.reserve(m_state->threads_count());
+                for (size_t i = 0; i < m_state->threads_count(); ++i)
+                    m_threads.emplace_back(&pool_state::run, m_state, i);
+            }
+
+            pool_handle(const pool_handle&) = delete;
+            pool_handle(pool_handle&&)      = delete;
+
+            ~pool_handle() noexcept
+            {
+                m_state->stop();
+                for (auto& thread : m_threads)
+                {
+                    // last worker can be released inside of schedulable executed by pool itself: such thread just finishes its work on its own
+                    if (thread.get_id() == std::this_thread::get_id())
+                        thread.detach();
+                    else
+                        thread.join();
+                }
+            }
+
+            const std::shared_ptr<pool_state>& get_state() const { return m_state; }
+
+        private:
+            std::shared_ptr<pool_state> m_state;
+            std::vector<std::thread>    m_threads{};
+        };
+
+    public:
+        class worker_strategy
+        {
+        public:
+            explicit worker_strategy(const std::shared_ptr<pool_handle>& handle)
+                : m_handle{handle}
+                , m_state{std::make_shared<worker_state>(handle->get_state())}
+            {
+            }
+
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_to(time_point tp, Fn&& fn, Handler&& handler, Args&&... args) const
+            {
+                m_state->defer_to(tp, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            }
+
+            bool is_current_executor() const
+            {
+                return m_state->is_current_executor();
+            }
+
+            static rpp::schedulers::time_point now() { return details::now(); }
+
+        private:
+            std::shared_ptr<pool_handle>  m_handle;
+            std::shared_ptr<worker_state> m_state;
+        };
+
+        explicit work_stealing_pool(size_t threads_count = std::thread::hardware_concurrency())
+            : m_handle{std::make_shared<pool_handle>(threads_count)}
+        {
+        }
+
+        rpp::schedulers::worker<worker_strategy> create_worker() const
+        {
+            return rpp::schedulers::worker<worker_strategy>{m_handle};
+        }
+
+    private:
+        std::shared_ptr<pool_handle> m_handle;
+    };
+} // namespace rpp::schedulers
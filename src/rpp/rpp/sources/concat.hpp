@@ -52,7 +52,7 @@ namespace rpp::details
     {
         static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::Boolean;
 
-        std::shared_ptr<concat_state_t<TObserver, PackedContainer>> state{};
+        rpp::details::disposable_ptr<concat_state_t<TObserver, PackedContainer>> state{};
 
         template<typename T>
         void on_next(T&& v) const
@@ -81,7 +81,7 @@ namespace rpp::details
     };
 
     template<rpp::constraint::observer TObserver, typename PackedContainer>
-    void drain(const std::shared_ptr<concat_state_t<TObserver, PackedContainer>>& state)
+    void drain(const rpp::details::disposable_ptr<concat_state_t<TObserver, PackedContainer>>& state)
     {
         while (!state->is_disposed())
         {
@@ -45,6 +45,7 @@ namespace rpp::source
      * 1) observable must to emit emissions in serial way
      * 2) observable must not to call any callbacks after termination events - on_error/on_completed
      * @warning Keep in mind, obtained observer is non-copyable, but movable by default. So, prefer perfect-forwarding. In case of you need to copy observer, cast it it dynamic_observer via passing it as argument type or via as_dynamic() member function
+     * @note Callback can honour demand of subscriber (see rpp::operators::with_demand) via `observer.get_demand()`: `try_consume()` before each emission and `park(...)` to be resumed on next request. Demand of plain observers is unbounded.
      *
      * @tparam Type is type of values observable would emit
      * @tparam OnSubscribe is callback function to implement core logic of observable
@@ -74,6 +75,7 @@ namespace rpp::source
      * 1) observable must to emit emissions in serial way
      * 2) observable must not to call any callbacks after termination events - on_error/on_completed
      * @warning Keep in mind, obtained observer is non-copyable, but movable by default. So, prefer perfect-forwarding. In case of you need to copy observer, cast it it dynamic_observer via passing it as argument type or via as_dynamic() member function
+     * @note Callback can honour demand of subscriber (see rpp::operators::with_demand) via `observer.get_demand()`: `try_consume()` before each emission and `park(...)` to be resumed on next request. Demand of plain observers is unbounded.
      *
      * @tparam Type is type of values observable would emit
      * @tparam OnSubscribe is callback function to implement core logic of observable
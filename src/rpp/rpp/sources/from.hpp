@@ -13,13 +13,17 @@
 
 #include <rpp/defs.hpp>
 #include <rpp/observables/observable.hpp>
+#include <rpp/observers/demand.hpp>
 #include <rpp/operators/map.hpp>
 #include <rpp/schedulers/current_thread.hpp>
 #include <rpp/utils/utils.hpp>
 
 #include <array>
+#include <atomic>
 #include <exception>
+#include <iterator>
 #include <memory>
+#include <span>
 #include <type_traits>
 #include <utility>
 
@@ -79,6 +83,84 @@ namespace rpp::details
         }
     };
 
+    /**
+     * @brief State of from_iterable subscribed with bounded demand: emits values only while there is demand and parks itself till next `request` otherwise.
+     */
+    template<constraint::decayed_type PackedContainer, rpp::constraint::observer Observer, typename Worker>
+    class from_iterable_demand_state final : public rpp::details::demand_waiter
+        , public std::enable_shared_from_this<from_iterable_demand_state<PackedContainer, Observer, Worker>>
+    {
+        struct handler
+        {
+            std::shared_ptr<from_iterable_demand_state> state{};
+
+            bool is_disposed() const { return state->m_observer.is_disposed(); }
+
+            void on_error(const std::exception_ptr& err) const { state->m_observer.on_error(err); }
+        };
+
+    public:
+        from_iterable_demand_state(const PackedContainer& container, Observer&& observer, Worker&& worker)
+            : m_container{container}
+            , m_observer{std::move(observer)}
+            , m_worker{std::move(worker)}
+        {
+        }
+
+        void on_demand() noexcept override { schedule(); }
+
+        void schedule()
+        {
+            // only one drain at a time: it is reset right before parking
+            if (m_is_scheduled.exchange(true, std::memory_order::acq_rel))
+                return;
+
+            m_worker.schedule([](const handler& h) { return h.state->emit_next(); }, handler{this->shared_from_this()});
+        }
+
+    private:
+        rpp::schedulers::optional_delay_from_now emit_next()
+        {
+            try
+            {
+                auto itr = std::cbegin(m_container);
+                auto end = std::cend(m_container);
+                std::advance(itr, static_cast<int64_t>(m_index));
+
+                if (itr != end)
+                {
+                    // obtained each time instead of keeping it: demand owns parked producer
+                    const auto demand = m_observer.get_demand();
+                    if (!demand.try_consume())
+                    {
+                        m_is_scheduled.store(false, std::memory_order::release);
+                        demand.park(this->shared_from_this());
+                        return std::nullopt;
+                    }
+
+                    m_observer.on_next(utils::as_const(*itr));
+                    ++m_index;
+                    if (std::next(itr) != end) // it was not last
+                        return schedulers::delay_from_now{};
+                }
+
+                m_observer.on_completed();
+            }
+            catch (...)
+            {
+                m_observer.on_error(std::current_exception());
+            }
+            return std::nullopt;
+        }
+
+    private:
+        RPP_NO_UNIQUE_ADDRESS PackedContainer m_container;
+        RPP_NO_UNIQUE_ADDRESS Observer        m_observer;
+        RPP_NO_UNIQUE_ADDRESS Worker          m_worker;
+        size_t                                m_index{};
+        std::atomic_bool                      m_is_scheduled{};
+    };
+
     template<constraint::decayed_type PackedContainer, schedulers::constraint::scheduler TScheduler>
     struct from_iterable_strategy
     {
@@ -97,10 +179,34 @@ namespace rpp::details
         RPP_NO_UNIQUE_ADDRESS PackedContainer container;
         RPP_NO_UNIQUE_ADDRESS TScheduler      scheduler;
 
+        static constexpr bool s_is_contiguous = std::contiguous_iterator<decltype(std::cbegin(std::declval<const PackedContainer&>()))>
+                                             && std::same_as<std::iter_value_t<decltype(std::cbegin(std::declval<const PackedContainer&>()))>, value_type>;
+
         template<constraint::observer_strategy<utils::iterable_value_t<PackedContainer>> Strategy>
         void subscribe(observer<utils::iterable_value_t<PackedContainer>, Strategy>&& obs) const
         {
-            if constexpr (std::same_as<TScheduler, schedulers::immediate>)
+            if (!obs.get_demand().is_unbounded())
+            {
+                using state = from_iterable_demand_state<PackedContainer, observer<utils::iterable_value_t<PackedContainer>, Strategy>, rpp::schedulers::utils::get_worker_t<TScheduler>>;
+                std::make_shared<state>(container, std::move(obs), scheduler.create_worker())->schedule();
+                return;
+            }
+
+            if constexpr (std::same_as<TScheduler, schedulers::immediate> && s_is_contiguous)
+            {
+                try
+                {
+                    // whole container is emitted as one batch
+                    const auto begin = std::cbegin(container);
+                    obs.on_next_batch(std::span<const value_type>{std::to_address(begin), static_cast<size_t>(std::distance(begin, std::cend(container)))});
+                    obs.on_completed();
+                }
+                catch (...)
+                {
+                    obs.on_error(std::current_exception());
+                }
+            }
+            else if constexpr (std::same_as<TScheduler, schedulers::immediate>)
             {
                 try
                 {
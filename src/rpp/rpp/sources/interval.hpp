@@ -20,7 +20,10 @@ namespace rpp::details
     {
         rpp::schedulers::optional_delay_from_this_timepoint operator()(const auto& observer, rpp::schedulers::duration period, size_t& counter) const
         {
-            observer.on_next(counter++);
+            // ticks without demand are skipped: there is nothing to pause for time based source
+            if (observer.get_demand().try_consume())
+                observer.on_next(counter);
+            ++counter;
             return rpp::schedulers::optional_delay_from_this_timepoint{period};
         }
     };
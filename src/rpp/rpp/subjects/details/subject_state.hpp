@@ -23,6 +23,7 @@
 #include <list>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <variant>
 
 namespace rpp::subjects::details
@@ -44,7 +45,7 @@ namespace rpp::subjects::details
             , public rpp::details::base_disposable
         {
         public:
-            disposable_with_observer(TObs&& observer, std::weak_ptr<subject_state> state)
+            disposable_with_observer(TObs&& observer, disposable_wrapper_impl<subject_state> state)
                 : rpp::details::observers::type_erased_observer<TObs>{std::move(observer)}
                 , m_state{std::move(state)}
             {
@@ -63,10 +64,10 @@ namespace rpp::subjects::details
                 }
             }
 
-            std::weak_ptr<subject_state> m_state{};
+            disposable_wrapper_impl<subject_state> m_state{};
         };
 
-        using observer         = std::shared_ptr<rpp::details::observers::observer_vtable<Type>>;
+        using observer         = rpp::details::disposable_ptr<rpp::details::observers::observer_vtable<Type>>;
         using observers        = std::list<observer>;
         using shared_observers = std::shared_ptr<observers>;
         using state_t          = std::variant<shared_observers, std::exception_ptr, completed, disposed>;
@@ -83,7 +84,7 @@ namespace rpp::subjects::details
             process_state_unsafe(
                 m_state,
                 [&](const shared_observers& observers) {
-                    auto d   = disposable_wrapper_impl<disposable_with_observer<std::decay_t<TObs>>>::make(std::forward<TObs>(observer), this->wrapper_from_this().lock());
+                    auto d   = disposable_wrapper_impl<disposable_with_observer<std::decay_t<TObs>>>::make(std::forward<TObs>(observer), this->wrapper_from_this().as_weak());
                     auto ptr = d.lock();
                     if (!observers)
                     {
@@ -111,22 +112,18 @@ namespace rpp::subjects::details
 
         void on_next(const Type& v)
         {
-            std::unique_lock observers_lock{m_mutex};
-            process_state_unsafe(m_state, [&](shared_observers observers) {
-                if (!observers)
-                    return;
-
-                auto       itr  = observers->cbegin();
-                const auto size = observers->size();
-
-                observers_lock.unlock();
+            for_each_observer([&](const observer& obs) { obs->on_next(v); });
+        }
 
-                std::lock_guard lock{m_serialized_mutex};
-                for (size_t i = 0; i < size; ++i)
-                {
-                    (*(itr++))->on_next(v);
-                }
-            });
+        /**
+         * @brief Same as `on_next` for each value, but serialization lock is taken once per batch
+         * @details Observers are obtained again for each value, so each value reaches all observers before the next one and observer subscribed during emission obtains rest of batch.
+         */
+        void on_next_batch(std::span<const Type> values)
+        {
+            std::lock_guard lock{m_serialized_mutex};
+            for (const auto& v : values)
+                for_each_observer_serialized([&](const observer& obs) { obs->on_next(v); });
         }
 
         void on_error(const std::exception_ptr& err)
@@ -150,6 +147,32 @@ namespace rpp::subjects::details
         }
 
     private:
+        void for_each_observer(const auto& action)
+        {
+            std::lock_guard lock{m_serialized_mutex};
+            for_each_observer_serialized(action);
+        }
+
+        // expects `m_serialized_mutex` to be locked by caller
+        void for_each_observer_serialized(const auto& action)
+        {
+            std::unique_lock observers_lock{m_mutex};
+            process_state_unsafe(m_state, [&](shared_observers observers) {
+                if (!observers)
+                    return;
+
+                auto       itr  = observers->cbegin();
+                const auto size = observers->size();
+
+                observers_lock.unlock();
+
+                for (size_t i = 0; i < size; ++i)
+                {
+                    action(*(itr++));
+                }
+            });
+        }
+
         void composite_dispose_impl(interface_disposable::Mode) noexcept override
         {
             exchange_observers_under_lock_if_there(disposed{});
@@ -16,6 +16,8 @@
 #include <rpp/subjects/details/subject_on_subscribe.hpp>
 #include <rpp/subjects/details/subject_state.hpp>
 
+#include <span>
+
 namespace rpp::subjects::details
 {
     template<rpp::constraint::decayed_type Type, bool Serialized>
@@ -25,7 +27,7 @@ namespace rpp::subjects::details
         {
             static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
 
-            std::shared_ptr<details::subject_state<Type, Serialized>> state{};
+            rpp::details::disposable_ptr<details::subject_state<Type, Serialized>> state{};
 
             void set_upstream(const disposable_wrapper& d) const noexcept { state->add(d); }
 
@@ -33,6 +35,8 @@ namespace rpp::subjects::details
 
             void on_next(const Type& v) const { state->on_next(v); }
 
+            void on_next_batch(std::span<const Type> values) const { state->on_next_batch(values); }
+
             void on_error(const std::exception_ptr& err) const { state->on_error(err); }
 
             void on_completed() const { state->on_completed(); }
@@ -45,21 +49,21 @@ namespace rpp::subjects::details
 
         auto get_observer() const
         {
-            return rpp::observer<Type, observer_strategy>{m_state.lock()};
+            return rpp::observer<Type, observer_strategy>{m_state};
         }
 
         auto get_observable() const
         {
-            return create_subject_on_subscribe_observable<Type, optimal_disposables_strategy>([state = m_state]<rpp::constraint::observer_of_type<Type> TObs>(TObs&& observer) { state.lock()->on_subscribe(std::forward<TObs>(observer)); });
+            return create_subject_on_subscribe_observable<Type, optimal_disposables_strategy>([state = m_state]<rpp::constraint::observer_of_type<Type> TObs>(TObs&& observer) { state->on_subscribe(std::forward<TObs>(observer)); });
         }
 
         rpp::disposable_wrapper get_disposable() const
         {
-            return m_state;
+            return m_state->wrapper_from_this();
         }
 
     private:
-        disposable_wrapper_impl<details::subject_state<Type, Serialized>> m_state = disposable_wrapper_impl<subject_state<Type, Serialized>>::make();
+        rpp::details::disposable_ptr<details::subject_state<Type, Serialized>> m_state = disposable_wrapper_impl<subject_state<Type, Serialized>>::make().lock();
     };
 } // namespace rpp::subjects::details
 namespace rpp::subjects
@@ -86,7 +86,7 @@ namespace rpp::subjects::details
         {
             static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
 
-            std::shared_ptr<replay_state> state;
+            rpp::details::disposable_ptr<replay_state> state;
 
             void set_upstream(const disposable_wrapper& d) const noexcept { state->add(d); }
 
@@ -107,42 +107,41 @@ namespace rpp::subjects::details
         using optimal_disposables_strategy = typename details::subject_state<Type, Serialized>::optimal_disposables_strategy;
 
         replay_subject_base()
-            : m_state{disposable_wrapper_impl<replay_state>::make()}
+            : m_state{disposable_wrapper_impl<replay_state>::make().lock()}
         {
         }
 
         replay_subject_base(size_t count)
-            : m_state{disposable_wrapper_impl<replay_state>::make(std::max<size_t>(1, count))}
+            : m_state{disposable_wrapper_impl<replay_state>::make(std::max<size_t>(1, count)).lock()}
         {
         }
 
         replay_subject_base(size_t count, rpp::schedulers::duration duration)
-            : m_state{disposable_wrapper_impl<replay_state>::make(std::max<size_t>(1, count), duration)}
+            : m_state{disposable_wrapper_impl<replay_state>::make(std::max<size_t>(1, count), duration).lock()}
         {
         }
 
         auto get_observer() const
         {
-            return rpp::observer<Type, observer_strategy>{m_state.lock()};
+            return rpp::observer<Type, observer_strategy>{m_state};
         }
 
         auto get_observable() const
         {
             return create_subject_on_subscribe_observable<Type, optimal_disposables_strategy>([state = m_state]<rpp::constraint::observer_of_type<Type> TObs>(TObs&& observer) {
-                const auto locked = state.lock();
-                for (auto&& value : locked->get_actual_values())
+                for (auto&& value : state->get_actual_values())
                     observer.on_next(std::move(value.value));
-                locked->on_subscribe(std::forward<TObs>(observer));
+                state->on_subscribe(std::forward<TObs>(observer));
             });
         }
 
         rpp::disposable_wrapper get_disposable() const
         {
-            return m_state;
+            return m_state->wrapper_from_this();
         }
 
     private:
-        disposable_wrapper_impl<replay_state> m_state;
+        rpp::details::disposable_ptr<replay_state> m_state;
     };
 } // namespace rpp::subjects::details
 
@@ -87,4 +87,16 @@ namespace rpp::utils
     template<typename Fn, typename... Args>
     using decayed_invoke_result_t = std::decay_t<std::invoke_result_t<Fn, Args...>>;
 
+    /**
+     * @brief Opt-in trait for callables without side effects and state: result depends only on arguments.
+     * @details Operators (like `map` or `filter`) are allowed to invoke such a callable for several values ahead of passing them downstream, for example, for whole batch of values at once. Any other callable is invoked strictly one value at a time. Specialize it with `std::true_type` to enable it for your callable.
+     */
+    template<typename Fn>
+    struct is_stateless_callable : std::false_type
+    {
+    };
+
+    template<typename Fn>
+    concept stateless_callable = is_stateless_callable<std::decay_t<Fn>>::value;
+
 } // namespace rpp::utils
@@ -18,6 +18,10 @@
 #include <mutex>
 #include <variant>
 
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+#endif
+
 namespace rpp::utils
 {
 
@@ -248,6 +252,20 @@ namespace rpp::utils
         RPP_NO_UNIQUE_ADDRESS T m_value;
     };
 
+    /**
+     * @brief Hint for CPU that current thread is busy-waiting (`pause` on x86, `yield` on ARM)
+     */
+    inline void cpu_relax() noexcept
+    {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        _mm_pause();
+#elif (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+        __builtin_ia32_pause();
+#elif (defined(__aarch64__) || defined(__arm__)) && (defined(__GNUC__) || defined(__clang__))
+        asm volatile("yield" ::: "memory");
+#endif
+    }
+
     struct none_mutex
     {
         static constexpr void lock() {}
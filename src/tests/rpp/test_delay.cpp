@@ -14,14 +14,23 @@
 #include <rpp/operators/as_blocking.hpp>
 #include <rpp/operators/delay.hpp>
 #include <rpp/operators/observe_on.hpp>
+#include <rpp/operators/subscribe_on.hpp>
+#include <rpp/operators/tap.hpp>
+#include <rpp/schedulers/immediate.hpp>
+#include <rpp/schedulers/new_thread.hpp>
 #include <rpp/schedulers/test_scheduler.hpp>
+#include <rpp/schedulers/thread_pool.hpp>
 #include <rpp/sources/empty.hpp>
 #include <rpp/sources/error.hpp>
+#include <rpp/sources/from.hpp>
 #include <rpp/sources/just.hpp>
 #include <rpp/subjects/publish_subject.hpp>
 
 #include "disposable_observable.hpp"
 
+#include <numeric>
+#include <vector>
+
 namespace
 {
 
@@ -288,3 +297,150 @@ TEST_CASE("observe_on forward error immediately")
         CHECK(scheduler.get_executions() == std::vector<rpp::schedulers::time_point>{});
     }
 }
+
+TEST_CASE("observe_on emits immediately when emission already happens inside target worker")
+{
+    const auto               pool = rpp::schedulers::thread_pool{1};
+    std::vector<std::string> events{};
+
+    rpp::source::just(1, 2, 3)
+        | rpp::ops::subscribe_on(pool)
+        | rpp::ops::tap([&](int v) { events.push_back("tap " + std::to_string(v)); })
+        | rpp::ops::observe_on(pool)
+        | rpp::ops::as_blocking()
+        | rpp::ops::subscribe([&](int v) { events.push_back("obs " + std::to_string(v)); },
+                              [&]() { events.push_back("completed"); });
+
+    CHECK(events == std::vector<std::string>{"tap 1", "obs 1", "tap 2", "obs 2", "tap 3", "obs 3", "completed"});
+
+    SUBCASE("non-zero delay is still scheduled")
+    {
+        events.clear();
+        rpp::source::just(rpp::schedulers::immediate{}, 1, 2)
+            | rpp::ops::subscribe_on(pool)
+            | rpp::ops::tap([&](int v) { events.push_back("tap " + std::to_string(v)); })
+            | rpp::ops::observe_on(pool, std::chrono::nanoseconds{1})
+            | rpp::ops::as_blocking()
+            | rpp::ops::subscribe([&](int v) { events.push_back("obs " + std::to_string(v)); });
+
+        CHECK(events == std::vector<std::string>{"tap 1", "tap 2", "obs 1", "obs 2"});
+    }
+
+    SUBCASE("recursive emission from downstream is queued till end of current one")
+    {
+        events.clear();
+        rpp::subjects::publish_subject<int> subj{};
+        subj.get_observable()
+            | rpp::ops::observe_on(pool)
+            | rpp::ops::subscribe([&](int v) {
+                  events.push_back("begin " + std::to_string(v));
+                  if (v < 3)
+                      subj.get_observer().on_next(v + 1);
+                  events.push_back("end " + std::to_string(v));
+              });
+
+        rpp::source::just(1)
+            | rpp::ops::subscribe_on(pool)
+            | rpp::ops::as_blocking()
+            | rpp::ops::subscribe([&](int v) { subj.get_observer().on_next(v); });
+
+        CHECK(events == std::vector<std::string>{"begin 1", "end 1", "begin 2", "end 2", "begin 3", "end 3"});
+    }
+}
+
+TEST_CASE("delay with bounded queue applies overflow policy")
+{
+    auto                      mock = mock_observer_strategy<int>{};
+    std::chrono::milliseconds delay_duration{300};
+    auto                      scheduler  = rpp::schedulers::test_scheduler{};
+    auto                      statistics = rpp::overflow_statistics{};
+
+    const auto subscribe_with_policy = [&](rpp::overflow_policy policy) {
+        rpp::source::just(rpp::schedulers::immediate{}, 1, 2, 3, 4, 5)
+            | rpp::ops::delay(delay_duration, scheduler, {.capacity = 2, .policy = policy, .statistics = statistics})
+            | rpp::ops::subscribe(mock);
+        scheduler.time_advance(delay_duration);
+    };
+
+    SUBCASE("drop_newest keeps first values")
+    {
+        subscribe_with_policy(rpp::overflow_policy::drop_newest);
+        CHECK(mock.get_received_values() == std::vector{1, 2});
+        CHECK(mock.get_on_completed_count() == 1);
+        CHECK(statistics.snapshot().overflows == 3);
+        CHECK(statistics.snapshot().dropped == 3);
+    }
+    SUBCASE("drop_oldest keeps last values")
+    {
+        subscribe_with_policy(rpp::overflow_policy::drop_oldest);
+        CHECK(mock.get_received_values() == std::vector{4, 5});
+        CHECK(mock.get_on_completed_count() == 1);
+        CHECK(statistics.snapshot().dropped == 3);
+    }
+    SUBCASE("latest_only replaces newest queued value")
+    {
+        subscribe_with_policy(rpp::overflow_policy::latest_only);
+        CHECK(mock.get_received_values() == std::vector{1, 5});
+        CHECK(mock.get_on_completed_count() == 1);
+        CHECK(statistics.snapshot().dropped == 3);
+    }
+    SUBCASE("latest_only delays replaced value from its own arrival")
+    {
+        rpp::subjects::publish_subject<int> subject{};
+        subject.get_observable()
+            | rpp::ops::delay(delay_duration, scheduler, {.capacity = 2, .policy = rpp::overflow_policy::latest_only})
+            | rpp::ops::subscribe(mock);
+
+        subject.get_observer().on_next(1);
+        subject.get_observer().on_next(2);
+        scheduler.time_advance(std::chrono::milliseconds{100});
+        subject.get_observer().on_next(3);
+
+        scheduler.time_advance(delay_duration - std::chrono::milliseconds{100});
+        CHECK(mock.get_received_values() == std::vector{1});
+
+        scheduler.time_advance(std::chrono::milliseconds{100});
+        CHECK(mock.get_received_values() == std::vector{1, 3});
+    }
+    SUBCASE("error emits queue_overflow after queued values")
+    {
+        subscribe_with_policy(rpp::overflow_policy::error);
+        CHECK(mock.get_received_values() == std::vector{1, 2});
+        CHECK(mock.get_on_error_count() == 1);
+        CHECK(mock.get_on_completed_count() == 0);
+        CHECK(statistics.snapshot().overflows == 1);
+        CHECK(statistics.snapshot().dropped == 0);
+    }
+}
+
+TEST_CASE("observe_on with bounded queue")
+{
+    auto mock       = mock_observer_strategy<int>{};
+    auto statistics = rpp::overflow_statistics{};
+
+    SUBCASE("error is forwarded immediately")
+    {
+        auto scheduler = rpp::schedulers::test_scheduler{};
+        rpp::source::just(rpp::schedulers::immediate{}, 1, 2, 3)
+            | rpp::ops::observe_on(scheduler, {.capacity = 1, .policy = rpp::overflow_policy::error, .statistics = statistics}, std::chrono::seconds{1})
+            | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values().empty());
+        CHECK(mock.get_on_error_count() == 1);
+        CHECK(statistics.snapshot().overflows == 1);
+    }
+    SUBCASE("block waits for consumer and loses nothing")
+    {
+        std::vector<int> values(100);
+        std::iota(values.begin(), values.end(), 0);
+
+        rpp::source::from_iterable(values, rpp::schedulers::immediate{})
+            | rpp::ops::observe_on(rpp::schedulers::new_thread{}, {.capacity = 4, .policy = rpp::overflow_policy::block, .statistics = statistics})
+            | rpp::ops::as_blocking()
+            | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == values);
+        CHECK(mock.get_on_completed_count() == 1);
+        CHECK(statistics.snapshot().dropped == 0);
+    }
+}
@@ -13,6 +13,11 @@
 #include <rpp/disposables/disposable_wrapper.hpp>
 #include <rpp/disposables/refcount_disposable.hpp>
 
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 namespace
 {
     struct custom_disposable : public rpp::interface_disposable
@@ -27,9 +32,9 @@ namespace
     };
 } // namespace
 
-TEST_CASE_TEMPLATE("disposable keeps state", TestType, rpp::details::disposables::dynamic_disposables_container, rpp::details::disposables::static_disposables_container<1>)
+TEST_CASE_TEMPLATE("disposable keeps state", TestType, rpp::composite_disposable_impl<rpp::details::disposables::dynamic_disposables_container>, rpp::composite_disposable_impl<rpp::details::disposables::static_disposables_container<1>>, rpp::composite_disposable_impl<rpp::details::disposables::small_dynamic_disposables_container<1>>, rpp::sharded_composite_disposable_impl<rpp::details::disposables::dynamic_disposables_container, 4>)
 {
-    auto d = rpp::composite_disposable_wrapper::make<rpp::composite_disposable_impl<TestType>>();
+    auto d = rpp::composite_disposable_wrapper::make<TestType>();
 
     CHECK(!d.is_disposed());
 
@@ -192,6 +197,43 @@ TEST_CASE_TEMPLATE("disposable keeps state", TestType, rpp::details::disposables
     }
 }
 
+TEST_CASE_TEMPLATE("composite disposable handles concurrent add/remove", TestType, rpp::composite_disposable, rpp::sharded_composite_disposable<4>)
+{
+    constexpr size_t threads_count = 8;
+    constexpr size_t iterations    = 1000;
+
+    auto d = rpp::composite_disposable_wrapper::make<TestType>();
+
+    std::vector<rpp::disposable_wrapper> kept{};
+    std::mutex                           kept_mutex{};
+
+    std::vector<std::thread> threads{};
+    for (size_t t = 0; t < threads_count; ++t)
+    {
+        threads.emplace_back([&] {
+            for (size_t i = 0; i < iterations; ++i)
+            {
+                auto removed = rpp::composite_disposable_wrapper::make();
+                d.add(removed);
+                d.remove(removed);
+
+                auto added = rpp::composite_disposable_wrapper::make();
+                d.add(added);
+
+                std::lock_guard lock{kept_mutex};
+                kept.push_back(added);
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    CHECK(std::none_of(kept.begin(), kept.end(), [](const auto& v) { return v.is_disposed(); }));
+
+    d.dispose();
+    CHECK(std::all_of(kept.begin(), kept.end(), [](const auto& v) { return v.is_disposed(); }));
+}
+
 TEST_CASE("refcount disposable dispose underlying in case of reaching zero")
 {
     auto refcount   = rpp::disposable_wrapper_impl<rpp::refcount_disposable>::make();
@@ -267,6 +309,93 @@ TEST_CASE("refcount disposable dispose underlying in case of reaching zero")
     }
 }
 
+TEST_CASE("refcount disposable releases each reference exactly once")
+{
+    auto refcount   = rpp::disposable_wrapper_impl<rpp::refcount_disposable>::make();
+    auto underlying = rpp::disposable_wrapper_impl<custom_disposable>::make();
+    refcount.add(underlying);
+
+    std::vector<rpp::composite_disposable_wrapper> refs{};
+    for (size_t i = 0; i < 100; ++i)
+        refs.push_back(refcount.lock()->add_ref());
+
+    SUBCASE("references released by destruction and disposing in mixed order")
+    {
+        for (size_t i = 0; i < refs.size(); i += 2)
+        {
+            refs[i].dispose();
+            refs[i].dispose();
+        }
+        for (size_t i = 1; i < refs.size() - 1; i += 2)
+            refs[i] = rpp::composite_disposable_wrapper::empty();
+
+        CHECK(!refcount.is_disposed());
+        CHECK(underlying.lock()->dispose_count == 0);
+
+        refs.back().dispose();
+        CHECK(refcount.is_disposed());
+        CHECK(underlying.lock()->dispose_count == 1);
+    }
+
+    SUBCASE("disposing of refcount disposes all references and their sub-disposables")
+    {
+        auto inner = rpp::disposable_wrapper_impl<custom_disposable>::make();
+        refs.front().add(inner);
+
+        refcount.dispose();
+        CHECK(std::all_of(refs.begin(), refs.end(), [](const auto& v) { return v.is_disposed(); }));
+        CHECK(inner.lock()->dispose_count == 1);
+        CHECK(underlying.lock()->dispose_count == 1);
+    }
+}
+
+TEST_CASE("disposable_wrapper is single pointer")
+{
+    static_assert(sizeof(rpp::disposable_wrapper) == sizeof(void*));
+    static_assert(sizeof(rpp::composite_disposable_wrapper) == sizeof(void*));
+
+    auto d = rpp::composite_disposable_wrapper::make();
+
+    SUBCASE("weak wrapper checks disposed state without keeping disposable alive")
+    {
+        const auto weak = d.as_weak();
+        CHECK(d.lock().use_count() == 2);
+
+        CHECK(!weak.is_disposed());
+        CHECK(d.lock().use_count() == 2);
+
+        d.dispose();
+        CHECK(weak.is_disposed());
+        CHECK(d.lock().use_count() == 2);
+    }
+
+    SUBCASE("weak wrapper of custom disposable")
+    {
+        auto       custom = rpp::disposable_wrapper_impl<custom_disposable>::make();
+        const auto weak   = custom.as_weak();
+
+        CHECK(!weak.is_disposed());
+        custom.dispose();
+        custom.dispose();
+        CHECK(weak.is_disposed());
+    }
+
+    SUBCASE("weak wrapper of destroyed disposable is disposed")
+    {
+        const auto weak = d.as_weak();
+        d               = rpp::composite_disposable_wrapper::empty();
+
+        CHECK(weak.is_disposed());
+        CHECK(!weak.lock());
+    }
+
+    SUBCASE("empty wrapper is disposed")
+    {
+        CHECK(rpp::composite_disposable_wrapper::empty().is_disposed());
+        CHECK(rpp::composite_disposable_wrapper::empty() == rpp::composite_disposable_wrapper::empty());
+    }
+}
+
 TEST_CASE("composite_disposable correctly handles exception")
 {
     auto d  = rpp::composite_disposable_wrapper::make<rpp::composite_disposable_impl<rpp::details::disposables::static_disposables_container<1>>>();
@@ -282,6 +411,147 @@ TEST_CASE("composite_disposable correctly handles exception")
     CHECK(!d2.is_disposed());
 }
 
+TEST_CASE("dynamic_disposables_container removes by handle")
+{
+    rpp::details::disposables::dynamic_disposables_container container{};
+
+    auto d1 = rpp::composite_disposable_wrapper::make();
+    auto d2 = rpp::composite_disposable_wrapper::make();
+
+    const auto h1 = container.push_back(d1);
+    const auto h2 = container.push_back(d2);
+
+    SUBCASE("remove returns removed disposable")
+    {
+        CHECK(container.remove(h1) == d1);
+        container.dispose();
+        CHECK(!d1.is_disposed());
+        CHECK(d2.is_disposed());
+
+        SUBCASE("stale handle is ignored even if slot is reused")
+        {
+            auto       d3 = rpp::composite_disposable_wrapper::make();
+            const auto h3 = container.push_back(d3);
+            CHECK(h3.index == h1.index);
+            CHECK(h3 != h1);
+
+            CHECK(container.remove(h1).is_disposed());
+            CHECK(container.remove(h3) == d3);
+        }
+    }
+
+    SUBCASE("handles are stale after clear")
+    {
+        container.clear();
+        CHECK(container.remove(h1).is_disposed());
+        CHECK(container.remove(h2).is_disposed());
+        container.dispose();
+        CHECK(!d1.is_disposed());
+        CHECK(!d2.is_disposed());
+    }
+
+    SUBCASE("composite_disposable supports handles")
+    {
+        auto composite = rpp::disposable_wrapper_impl<rpp::composite_disposable>::make();
+        auto locked    = composite.lock();
+
+        const auto handle = locked->add_with_handle(d1);
+        REQUIRE(handle.has_value());
+        CHECK(locked->remove(handle.value()) == d1);
+
+        locked->add_with_handle(d2);
+        composite.dispose();
+        CHECK(!d1.is_disposed());
+        CHECK(d2.is_disposed());
+        CHECK(!locked->add_with_handle(d1).has_value());
+        CHECK(d1.is_disposed());
+    }
+}
+
+TEST_CASE("small_dynamic_disposables_container spills to heap beyond inline count")
+{
+    rpp::details::disposables::small_dynamic_disposables_container<2> container{};
+
+    std::vector<rpp::composite_disposable_wrapper> disposables{};
+    for (size_t i = 0; i < 4; ++i)
+    {
+        disposables.push_back(rpp::composite_disposable_wrapper::make());
+        container.push_back(disposables.back());
+    }
+
+    SUBCASE("dispose disposes inline and spilled disposables")
+    {
+        container.dispose();
+        CHECK(std::all_of(disposables.begin(), disposables.end(), [](const auto& d) { return d.is_disposed(); }));
+    }
+
+    SUBCASE("remove inline and spilled disposables")
+    {
+        container.remove(disposables[0]);
+        container.remove(disposables[3]);
+        container.dispose();
+        CHECK(!disposables[0].is_disposed());
+        CHECK(disposables[1].is_disposed());
+        CHECK(disposables[2].is_disposed());
+        CHECK(!disposables[3].is_disposed());
+    }
+
+    SUBCASE("move container")
+    {
+        auto other = std::move(container);
+        container.dispose(); // NOLINT
+        CHECK(std::none_of(disposables.begin(), disposables.end(), [](const auto& d) { return d.is_disposed(); }));
+
+        other.dispose();
+        CHECK(std::all_of(disposables.begin(), disposables.end(), [](const auto& d) { return d.is_disposed(); }));
+    }
+
+    SUBCASE("clear")
+    {
+        container.clear();
+        container.dispose();
+        CHECK(std::none_of(disposables.begin(), disposables.end(), [](const auto& d) { return d.is_disposed(); }));
+    }
+}
+
+TEST_CASE("disposables created inside subscription_arena scope outlive it")
+{
+    std::vector<rpp::composite_disposable_wrapper> disposables{};
+    {
+        const rpp::details::disposables::subscription_arena::scope scope{};
+        // more than fits into one chunk
+        for (size_t i = 0; i < 32; ++i)
+            disposables.push_back(rpp::composite_disposable_wrapper::make());
+
+        disposables.push_back(rpp::composite_disposable_wrapper::make<rpp::sharded_composite_disposable<2>>());
+
+        const rpp::details::disposables::subscription_arena::suspend_scope suspend{};
+        disposables.push_back(rpp::composite_disposable_wrapper::make());
+    }
+
+    CHECK(std::none_of(disposables.begin(), disposables.end(), [](const auto& d) { return d.is_disposed(); }));
+
+    for (size_t i = 0; i < disposables.size(); i += 2)
+        disposables[i].dispose();
+
+    SUBCASE("destroy in reverse order")
+    {
+        while (!disposables.empty())
+            disposables.pop_back();
+    }
+
+    SUBCASE("destroy even ones first")
+    {
+        for (size_t i = 0; i < disposables.size(); i += 2)
+            disposables[i] = rpp::composite_disposable_wrapper::empty();
+
+        for (size_t i = 1; i < disposables.size(); i += 2)
+            CHECK(!disposables[i].is_disposed());
+
+        disposables.clear();
+    }
+}
+
 TEST_CASE("static_disposables_container works as expected")
 {
     rpp::details::disposables::static_disposables_container<2> container{};
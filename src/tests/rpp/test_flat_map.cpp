@@ -19,12 +19,14 @@
 #include <rpp/sources/error.hpp>
 #include <rpp/sources/just.hpp>
 #include <rpp/sources/never.hpp>
+#include <rpp/subjects/publish_subject.hpp>
 
 #include "copy_count_tracker.hpp"
 #include "disposable_observable.hpp"
 
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 TEST_CASE_TEMPLATE("flat_map", TestType, rpp::memory_model::use_stack, rpp::memory_model::use_shared)
 {
@@ -141,3 +143,29 @@ TEST_CASE("flat_map satisfies disposable contracts")
 {
     test_operator_with_disposable<int>(rpp::ops::flat_map([](const auto& v) { return rpp::source::just(v); }));
 }
+
+TEST_CASE("flat_map with max_concurrent")
+{
+    auto                                             mock = mock_observer_strategy<int>();
+    std::vector<rpp::subjects::publish_subject<int>> subjects(3);
+
+    rpp::source::just(rpp::schedulers::immediate{}, 0, 1, 2)
+        | rpp::ops::flat_map([&subjects](int i) { return subjects[static_cast<size_t>(i)].get_observable(); }, 1)
+        | rpp::ops::subscribe(mock);
+
+    const auto emit_to_all = [&subjects](int v) {
+        for (const auto& s : subjects)
+            s.get_observer().on_next(v);
+    };
+
+    emit_to_all(1);
+    CHECK(mock.get_received_values() == std::vector{1});
+
+    subjects[0].get_observer().on_completed();
+    emit_to_all(2);
+    CHECK(mock.get_received_values() == std::vector{1, 2});
+
+    subjects[1].get_observer().on_completed();
+    subjects[2].get_observer().on_completed();
+    CHECK(mock.get_on_completed_count() == 1);
+}
@@ -11,8 +11,12 @@
 #include <doctest/doctest.h>
 
 #include <rpp/observers/mock_observer.hpp>
+#include <rpp/operators/filter.hpp>
+#include <rpp/operators/map.hpp>
+#include <rpp/operators/skip.hpp>
 #include <rpp/operators/take.hpp>
 #include <rpp/sources/from.hpp>
+#include <rpp/subjects/publish_subject.hpp>
 
 #include "copy_count_tracker.hpp"
 #include "rpp/memory_model.hpp"
@@ -25,7 +29,11 @@
 #include <cstddef>
 #include <functional>
 #include <optional>
+#include <span>
 #include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 struct my_container_with_error : std::vector<int>
 {
@@ -228,6 +236,146 @@ TEST_CASE_TEMPLATE("from iterable doesn't provides extra copies", TestType, rpp:
     }
 }
 
+struct batch_counting_strategy
+{
+    static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::Auto;
+
+    std::vector<int>* values;
+    size_t*           batches;
+
+    void on_next(const int& v) const { values->push_back(v); }
+    void on_next(int&& v) const { values->push_back(v); }
+    void on_next_batch(std::span<const int> batch) const
+    {
+        ++*batches;
+        values->insert(values->end(), batch.begin(), batch.end());
+    }
+    static void on_error(const std::exception_ptr&) {}
+    static void on_completed() {}
+    static void set_upstream(const rpp::disposable_wrapper&) {}
+    static bool is_disposed() { return false; }
+};
+
+struct multiply_by_ten
+{
+    int operator()(int v) const { return v * 10; }
+};
+
+struct not_divisible_by_three
+{
+    bool operator()(int v) const { return v % 3 != 0; }
+};
+
+struct counting_accept_all
+{
+    static inline size_t calls{};
+
+    bool operator()(int) const { return ++calls != 0; }
+};
+
+template<>
+struct rpp::utils::is_stateless_callable<counting_accept_all> : std::true_type
+{
+};
+
+template<>
+struct rpp::utils::is_stateless_callable<multiply_by_ten> : std::true_type
+{
+};
+
+template<>
+struct rpp::utils::is_stateless_callable<not_divisible_by_three> : std::true_type
+{
+};
+
+TEST_CASE("from iterable with immediate scheduler emits contiguous container as batch")
+{
+    const auto       vals = std::vector{1, 2, 3, 4, 5, 6, 7, 8};
+    std::vector<int> received{};
+    size_t           batches{};
+    const auto       obs = rpp::source::from_iterable(vals, rpp::schedulers::immediate{});
+
+    SUBCASE("observer obtains whole container at once")
+    {
+        obs.subscribe(rpp::observer<int, batch_counting_strategy>{&received, &batches});
+        CHECK(received == vals);
+        CHECK(batches == 1);
+    }
+    SUBCASE("batch passes through map, skip and take")
+    {
+        obs | rpp::operators::map(multiply_by_ten{}) | rpp::operators::skip(2) | rpp::operators::take(3) | rpp::operators::subscribe(rpp::observer<int, batch_counting_strategy>{&received, &batches});
+        CHECK(received == std::vector{30, 40, 50});
+        CHECK(batches == 1);
+    }
+    SUBCASE("filter passes runs of accepted values")
+    {
+        obs | rpp::operators::filter(not_divisible_by_three{}) | rpp::operators::subscribe(rpp::observer<int, batch_counting_strategy>{&received, &batches});
+        CHECK(received == std::vector{1, 2, 4, 5, 7, 8});
+        CHECK(batches == 3);
+    }
+    SUBCASE("map and filter with callables which are not stateless process values one by one")
+    {
+        std::vector<std::string> log{};
+        const auto               log_on_next = [&](int v) { log.push_back("on_next " + std::to_string(v)); };
+
+        SUBCASE("map")
+        {
+            obs | rpp::operators::map([&](int v) { log.push_back("map " + std::to_string(v)); return v; })
+                | rpp::operators::take(2)
+                | rpp::operators::subscribe(log_on_next);
+            CHECK(log == std::vector<std::string>{"map 1", "on_next 1", "map 2", "on_next 2"});
+        }
+        SUBCASE("filter")
+        {
+            obs | rpp::operators::filter([&](int v) { log.push_back("filter " + std::to_string(v)); return v != 2; })
+                | rpp::operators::take(2)
+                | rpp::operators::subscribe(log_on_next);
+            CHECK(log == std::vector<std::string>{"filter 1", "on_next 1", "filter 2", "filter 3", "on_next 3"});
+        }
+    }
+    SUBCASE("stateless predicate is invoked ahead only within small chunk")
+    {
+        counting_accept_all::calls = 0;
+        rpp::source::from_iterable(std::vector<int>(100'000, 1), rpp::schedulers::immediate{})
+            | rpp::operators::filter(counting_accept_all{})
+            | rpp::operators::take(1)
+            | rpp::operators::subscribe([](int) {});
+        CHECK(counting_accept_all::calls <= 64);
+    }
+    SUBCASE("values before exception are emitted before error")
+    {
+        auto mock = mock_observer_strategy<int>{};
+        obs | rpp::operators::map([](int v) {
+            if (v == 4)
+                throw std::runtime_error{""};
+            return v;
+        }) | rpp::operators::subscribe(mock);
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3});
+        CHECK(mock.get_on_error_count() == 1);
+    }
+    SUBCASE("publish_subject passes each value of batch to all observers before next one")
+    {
+        rpp::subjects::publish_subject<int> subj{};
+        subj.get_observable().subscribe(rpp::observer<int, batch_counting_strategy>{&received, &batches}.as_dynamic());
+        subj.get_observable().subscribe(rpp::observer<int, batch_counting_strategy>{&received, &batches}.as_dynamic());
+
+        obs.subscribe(subj.get_observer());
+        CHECK(received == std::vector{1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8});
+    }
+    SUBCASE("observer subscribed to publish_subject during batch obtains rest of it")
+    {
+        rpp::subjects::publish_subject<int> subj{};
+        std::vector<int>                    late{};
+        subj.get_observable().subscribe([&](int v) {
+            if (v == 1)
+                subj.get_observable().subscribe([&](int v) { late.push_back(v); });
+        });
+
+        obs.subscribe(subj.get_observer());
+        CHECK(late == std::vector{2, 3, 4, 5, 6, 7, 8});
+    }
+}
+
 TEST_CASE("from callable")
 {
     auto mock = mock_observer_strategy<int>{};
@@ -18,14 +18,19 @@
 #include <rpp/schedulers/new_thread.hpp>
 #include <rpp/sources/create.hpp>
 #include <rpp/sources/error.hpp>
+#include <rpp/sources/from.hpp>
 #include <rpp/sources/just.hpp>
 #include <rpp/sources/never.hpp>
+#include <rpp/subjects/publish_subject.hpp>
 
 #include "copy_count_tracker.hpp"
 #include "disposable_observable.hpp"
 
+#include <chrono>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <vector>
 
 TEST_CASE_TEMPLATE("merge for observable of observables", TestType, rpp::memory_model::use_stack, rpp::memory_model::use_shared)
 {
@@ -206,6 +211,109 @@ TEST_CASE_TEMPLATE("merge serializes emissions", TestType, rpp::memory_model::us
     }
 }
 
+TEST_CASE("merge with max_concurrent")
+{
+    auto mock = mock_observer_strategy<int>();
+
+    SUBCASE("observable of subjects' observables")
+    {
+        std::vector<rpp::subjects::publish_subject<int>> subjects(3);
+
+        rpp::source::just(rpp::schedulers::immediate{}, subjects[0].get_observable(), subjects[1].get_observable(), subjects[2].get_observable())
+            | rpp::ops::merge(2)
+            | rpp::ops::subscribe(mock);
+
+        SUBCASE("only max_concurrent inner observables are subscribed")
+        {
+            for (size_t i = 0; i < subjects.size(); ++i)
+                subjects[i].get_observer().on_next(static_cast<int>(i));
+
+            CHECK(mock.get_received_values() == std::vector{0, 1});
+        }
+
+        SUBCASE("queued observable is subscribed when active one completes")
+        {
+            subjects[0].get_observer().on_completed();
+            for (size_t i = 0; i < subjects.size(); ++i)
+                subjects[i].get_observer().on_next(static_cast<int>(i));
+
+            CHECK(mock.get_received_values() == std::vector{1, 2});
+            CHECK(mock.get_on_completed_count() == 0);
+
+            SUBCASE("merge completes when all observables complete")
+            {
+                subjects[1].get_observer().on_completed();
+                CHECK(mock.get_on_completed_count() == 0);
+
+                subjects[2].get_observer().on_completed();
+                CHECK(mock.get_on_completed_count() == 1);
+            }
+        }
+
+        SUBCASE("queued observables are not subscribed after error")
+        {
+            subjects[0].get_observer().on_error({});
+            subjects[2].get_observer().on_next(2);
+
+            CHECK(mock.get_on_error_count() == 1);
+            CHECK(mock.get_total_on_next_count() == 0);
+        }
+    }
+
+    SUBCASE("many queued observables completing during subscription")
+    {
+        rpp::subjects::publish_subject<int>       first{};
+        std::vector<rpp::dynamic_observable<int>> observables{first.get_observable().as_dynamic()};
+        for (int i = 0; i < 10'000; ++i)
+            observables.push_back(rpp::source::just(rpp::schedulers::immediate{}, i).as_dynamic());
+
+        rpp::source::from_iterable(observables, rpp::schedulers::immediate{})
+            | rpp::ops::merge(1)
+            | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_total_on_next_count() == 0);
+
+        first.get_observer().on_completed();
+        CHECK(mock.get_total_on_next_count() == 10'000);
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+}
+
+TEST_CASE("merge doesn't block producer while downstream is busy")
+{
+    std::optional<rpp::dynamic_observer<int>> extracted_obs{};
+    auto                                      delayed_obs = rpp::source::create<int>([&](auto&& obs) {
+        extracted_obs.emplace(std::forward<decltype(obs)>(obs).as_dynamic());
+    });
+
+    std::vector<int> values{};
+    std::atomic_bool producer_returned{};
+    std::thread      producer{};
+
+    rpp::source::just(1) | rpp::ops::merge_with(delayed_obs) | rpp::ops::subscribe([&](int v) {
+        values.push_back(v);
+        if (v != 1)
+            return;
+
+        REQUIRE(extracted_obs.has_value());
+        producer = std::thread{[&] {
+            extracted_obs->on_next(2);
+            producer_returned = true;
+        }};
+
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+        while (!producer_returned && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::yield();
+
+        CHECK(producer_returned);
+        // value of producer is emitted by this thread after current on_next
+        CHECK(values == std::vector{1});
+    });
+
+    producer.join();
+    CHECK(values == std::vector{1, 2});
+}
+
 TEST_CASE_TEMPLATE("merge handles race condition", TestType, rpp::memory_model::use_stack, rpp::memory_model::use_shared)
 {
     SUBCASE("source observable in current thread pairs with error in other thread")
@@ -19,12 +19,20 @@
 #include <rpp/subjects/replay_subject.hpp>
 
 #include "rpp/disposables/fwd.hpp"
+#include "rpp/operators/filter.hpp"
 #include "rpp/operators/fwd.hpp"
+#include "rpp/operators/map.hpp"
 #include "rpp/operators/subscribe.hpp"
 #include "rpp/operators/take.hpp"
+#include "rpp/operators/take_while.hpp"
+#include "rpp/operators/tap.hpp"
 
+#include <array>
 #include <chrono>
+#include <optional>
+#include <string>
 #include <thread>
+#include <vector>
 
 TEST_CASE("create observable works properly as observable")
 {
@@ -115,6 +123,53 @@ TEST_CASE("create observable works properly as observable")
     }
 }
 
+TEST_CASE("dynamic observable copies outlive original one")
+{
+    auto check = [](auto&& observable, const std::vector<int>& expected) {
+        std::optional<rpp::dynamic_observable<int>> original{std::forward<decltype(observable)>(observable).as_dynamic()};
+        auto                                        copy  = *original;
+        auto                                        moved = std::move(*original);
+        original.reset();
+
+        for (const auto& obs : {copy, moved})
+        {
+            std::vector<int> on_next_vals{};
+            obs.subscribe([&](int v) { on_next_vals.push_back(v); });
+            CHECK(on_next_vals == expected);
+        }
+    };
+
+    SUBCASE("small trivially copyable observable")
+    {
+        check(rpp::source::create<int>([](const auto& observer) {
+            observer.on_next(1);
+            observer.on_completed();
+        }),
+              std::vector{1});
+    }
+
+    SUBCASE("observable with non-trivial state")
+    {
+        check(rpp::source::create<int>([vals = std::vector{1, 2, 3}](const auto& observer) {
+            for (int v : vals)
+                observer.on_next(v);
+            observer.on_completed();
+        }),
+              std::vector{1, 2, 3});
+    }
+
+    SUBCASE("big observable")
+    {
+        std::array<int, 64> vals{1, 2};
+        check(rpp::source::create<int>([vals](const auto& observer) {
+            observer.on_next(vals[0]);
+            observer.on_next(vals[1]);
+            observer.on_completed();
+        }),
+              std::vector{1, 2});
+    }
+}
+
 TEST_CASE("blocking_observable blocks subscribe call")
 {
     mock_observer_strategy<int> mock{};
@@ -253,6 +308,72 @@ TEST_CASE("pipe observable works properly as observable")
     }
 }
 
+TEST_CASE("fused operators of chain behave same as separate ones")
+{
+    mock_observer_strategy<int> mock{};
+    std::vector<std::string>    events{};
+    size_t                      upstream_disposed{};
+
+    auto source = rpp::source::create<int>([&](auto&& observer) {
+        observer.set_upstream(rpp::make_callback_disposable([&]() noexcept { ++upstream_disposed; }));
+        for (int i = 0; i < 10 && !observer.is_disposed(); ++i)
+            observer.on_next(i);
+        observer.on_completed();
+    });
+
+    SUBCASE("values pass through all stages in order")
+    {
+        source
+            | rpp::operators::tap([&](int v) { events.push_back("first " + std::to_string(v)); })
+            | rpp::operators::filter([](int v) { return v % 2 == 0; })
+            | rpp::operators::map([](int v) { return v * 10; })
+            | rpp::operators::take_while([](int v) { return v < 50; })
+            | rpp::operators::tap([&](int v) { events.push_back("last " + std::to_string(v)); }, [&](const std::exception_ptr&) { events.push_back("last error"); }, [&]() { events.push_back("last completed"); })
+            | rpp::operators::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector{0, 20, 40});
+        CHECK(mock.get_on_error_count() == 0);
+        CHECK(mock.get_on_completed_count() == 1);
+        CHECK(upstream_disposed == 1);
+        CHECK(events == std::vector<std::string>{"first 0", "last 0", "first 1", "first 2", "last 20", "first 3", "first 4", "last 40", "first 5", "first 6", "last completed"});
+    }
+
+    SUBCASE("stages after disposing one don't see value")
+    {
+        auto d = rpp::composite_disposable_wrapper::make();
+        source
+            | rpp::operators::map([&](int v) {
+                  if (v == 1)
+                      d.dispose();
+                  return v;
+              })
+            | rpp::operators::tap([&](int v) { events.push_back("tap " + std::to_string(v)); })
+            | rpp::operators::subscribe(d, mock);
+
+        CHECK(mock.get_received_values() == std::vector{0});
+        CHECK(events == std::vector<std::string>{"tap 0"});
+    }
+
+    SUBCASE("exception of stage reaches only downstream stages")
+    {
+        source
+            | rpp::operators::tap([](int) {}, [&](const std::exception_ptr&) { events.push_back("first error"); }, [] {})
+            | rpp::operators::map([](int v) {
+                  if (v == 1)
+                      throw std::runtime_error{""};
+                  return v;
+              })
+            | rpp::operators::tap([](int) {}, [&](const std::exception_ptr&) { events.push_back("last error"); }, [] {})
+            | rpp::operators::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector{0});
+        CHECK(mock.get_on_error_count() == 1);
+        CHECK(mock.get_on_completed_count() == 0);
+        CHECK(upstream_disposed == 1);
+        CHECK(events == std::vector<std::string>{"last error"});
+    }
+}
+
 TEST_CASE_TEMPLATE(
     "observable has type traits defined",
     TestType,
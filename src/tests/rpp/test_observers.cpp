@@ -14,7 +14,10 @@
 #include "rpp/disposables/fwd.hpp"
 #include "rpp_trompeloil.hpp"
 
+#include <array>
+#include <atomic>
 #include <memory>
+#include <thread>
 #include <vector>
 
 TEST_CASE("lambda observer works properly as base observer")
@@ -75,6 +78,121 @@ TEST_CASE("lambda observer works properly as base observer")
     }
 }
 
+TEST_CASE("dynamic_observer shares observer between copies")
+{
+    std::vector<int> on_next_vals{};
+    size_t           on_completed{};
+
+    auto check = [&](auto&& observer) {
+        auto dynamic = std::forward<decltype(observer)>(observer).as_dynamic();
+
+        SUBCASE("moved observer keeps callbacks")
+        {
+            auto moved = std::move(dynamic);
+            moved.on_next(1);
+            CHECK(on_next_vals == std::vector{1});
+        }
+
+        SUBCASE("copies share the same observer")
+        {
+            dynamic.on_next(1);
+
+            auto copy = dynamic; // NOLINT
+            copy.on_next(2);
+            dynamic.on_next(3);
+
+            auto moved_copy = std::move(copy);
+            moved_copy.on_next(4);
+            CHECK(on_next_vals == std::vector{1, 2, 3, 4});
+
+            moved_copy.on_completed();
+            CHECK(on_completed == 1u);
+            CHECK(dynamic.is_disposed());
+
+            dynamic.on_completed();
+            CHECK(on_completed == 1u);
+        }
+
+        SUBCASE("copy assigned observer shares the same observer")
+        {
+            auto other = rpp::make_lambda_observer<int>([](int) {}).as_dynamic();
+            other      = dynamic;
+            other.on_next(1);
+            dynamic.on_completed();
+
+            CHECK(on_next_vals == std::vector{1});
+            CHECK(other.is_disposed());
+        }
+    };
+
+    SUBCASE("small observer")
+    {
+        check(rpp::make_lambda_observer<int>([&](int v) { on_next_vals.push_back(v); }, [](const std::exception_ptr&) {}, [&]() { ++on_completed; }));
+    }
+
+    SUBCASE("big observer")
+    {
+        std::array<char, 256> payload{};
+        check(rpp::make_lambda_observer<int>([&, payload](int v) { on_next_vals.push_back(v + payload[0]); }, [](const std::exception_ptr&) {}, [&]() { ++on_completed; }));
+    }
+}
+
+TEST_CASE("dynamic_observer can be copied from different threads")
+{
+    std::atomic<int> sum{};
+    auto             dynamic = rpp::make_lambda_observer<int>([&](int v) { sum += v; }).as_dynamic();
+    const auto&      source  = dynamic;
+
+    std::atomic_bool         start{};
+    std::vector<std::thread> threads{};
+    std::vector<std::vector<rpp::dynamic_observer<int>>> copies(2);
+
+    auto copy_in_threads = [&] {
+        for (auto& thread_copies : copies)
+        {
+            threads.emplace_back([&] {
+                while (!start)
+                {
+                };
+                for (size_t i = 0; i < 100; ++i)
+                    thread_copies.push_back(source);
+            });
+        }
+    };
+
+    SUBCASE("first copy is made concurrently")
+    {
+        copy_in_threads();
+        start = true;
+        for (auto& t : threads)
+            t.join();
+
+        dynamic.on_next(1);
+        for (const auto& thread_copies : copies)
+            for (const auto& copy : thread_copies)
+                copy.on_next(1);
+
+        CHECK(sum == 201);
+    }
+
+    SUBCASE("copies are made while observer emits")
+    {
+        auto emitter = source;
+        copy_in_threads();
+        start = true;
+        for (int i = 0; i < 1000; ++i)
+            emitter.on_next(1);
+        for (auto& t : threads)
+            t.join();
+
+        for (const auto& thread_copies : copies)
+            for (const auto& copy : thread_copies)
+                copy.on_next(1);
+
+        CHECK(sum == 1200);
+    }
+}
+
 TEST_CASE("as_dynamic keeps disposing")
 {
     auto check = [&](auto&& observer) {
@@ -23,6 +23,7 @@
 #include "rpp/disposables/fwd.hpp"
 #include "rpp_trompeloil.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <future>
 #include <optional>
@@ -30,6 +31,7 @@
 #include <stdexcept>
 #include <string>
 #include <thread>
+#include <vector>
 
 using namespace std::string_literals;
 
@@ -363,7 +365,7 @@ TEST_CASE("Immediate scheduler")
     }
 }
 
-TEST_CASE_TEMPLATE("queue_based scheduler", TestType, rpp::schedulers::current_thread, rpp::schedulers::new_thread, rpp::schedulers::thread_pool)
+TEST_CASE_TEMPLATE("queue_based scheduler", TestType, rpp::schedulers::current_thread, rpp::schedulers::new_thread, rpp::schedulers::thread_pool, rpp::schedulers::timer_wheel, rpp::schedulers::instrumented<rpp::schedulers::new_thread, rpp::schedulers::scheduler_statistics>)
 {
     auto d        = rpp::composite_disposable_wrapper::make();
     auto mock_obs = mock_observer_strategy<int>{};
@@ -398,14 +400,16 @@ TEST_CASE_TEMPLATE("queue_based scheduler", TestType, rpp::schedulers::current_t
             return thread_of_execution;
     };
 
+    // observer and locals captured by reference are used by schedulables till thread of worker is finished
     auto wait_till_finished = [&] {
         worker.reset();
-        obs.reset();
-        d = rpp::composite_disposable_wrapper::empty();
 
         while (!done->load())
         {
         };
+
+        obs.reset();
+        d = rpp::composite_disposable_wrapper::empty();
     };
 
     SUBCASE("scheduler schedules and re-schedules action immediately")
@@ -971,7 +975,7 @@ TEST_CASE("current_thread inside new_thread")
     auto started = std::make_shared<std::atomic_bool>();
     auto done    = std::make_shared<std::atomic_bool>();
 
-    worker->schedule([&](const auto&) {
+    worker->schedule([done](const auto&) {
         thread_local rpp::utils::finally_action s_th{[done] {
             done->store(true);
         }};
@@ -981,7 +985,7 @@ TEST_CASE("current_thread inside new_thread")
 
     auto current_thread_invoked = std::make_shared<std::atomic_bool>();
 
-    worker->schedule([&](const auto& obs) {
+    worker->schedule([current_thread_invoked, started](const auto& obs) {
         rpp::schedulers::current_thread{}.create_worker().schedule([current_thread_invoked](const auto&) {
             current_thread_invoked->store(true);
             return rpp::schedulers::optional_delay_from_now{};
@@ -1002,13 +1006,14 @@ TEST_CASE("current_thread inside new_thread")
     }
 
     worker.reset();
-    obs.reset();
-    d = rpp::composite_disposable_wrapper::empty();
 
     std::this_thread::sleep_for(std::chrono::seconds{1});
 
     REQUIRE(done->load());
     CHECK(current_thread_invoked->load());
+
+    obs.reset();
+    d = rpp::composite_disposable_wrapper::empty();
 }
 
 TEST_CASE("thread_pool uses multiple threads")
@@ -1068,3 +1073,615 @@ TEST_CASE("thread_pool shares same thread")
 
     CHECK(f.get());
 }
+
+TEST_CASE("new_thread accepts schedulables from multiple threads")
+{
+    constexpr int producers_count = 8;
+    constexpr int values_count    = 1000;
+
+    auto obs    = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+    auto worker = rpp::schedulers::new_thread::create_worker();
+
+    std::vector<std::vector<int>> executions(producers_count);
+    std::atomic_int               remaining{producers_count * values_count};
+    std::promise<void>            done{};
+
+    {
+        std::vector<std::thread> producers{};
+        for (int p = 0; p < producers_count; ++p)
+        {
+            producers.emplace_back([&, p] {
+                for (int i = 0; i < values_count; ++i)
+                {
+                    worker.schedule([&, p, i](const auto&) {
+                        executions[static_cast<size_t>(p)].push_back(i);
+                        if (remaining.fetch_sub(1) == 1)
+                            done.set_value();
+                        return rpp::schedulers::optional_delay_from_now{};
+                    },
+                                    obs);
+                }
+            });
+        }
+        for (auto& t : producers)
+            t.join();
+    }
+
+    done.get_future().get();
+
+    for (const auto& values : executions)
+    {
+        REQUIRE(values.size() == values_count);
+        CHECK(std::is_sorted(values.begin(), values.end()));
+    }
+}
+
+TEST_CASE("schedulables_queue keeps order by time_point and then by insertion")
+{
+    rpp::schedulers::details::schedulables_queue<rpp::schedulers::current_thread::worker_strategy> queue{};
+
+    auto       obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+    const auto now = rpp::schedulers::time_point{};
+
+    std::vector<int> out{};
+    const auto       push = [&](rpp::schedulers::duration delay, int value) {
+        queue.emplace(now + delay, [&out, value](const auto&) {
+            out.push_back(value);
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                      obs);
+    };
+
+    const auto drain = [&]() {
+        while (!queue.is_empty())
+            (*queue.pop())();
+    };
+
+    SUBCASE("same time_point keeps fifo order")
+    {
+        for (int i = 0; i < 10; ++i)
+            push(rpp::schedulers::duration{}, i);
+
+        CHECK(queue.size() == 10);
+        drain();
+        CHECK(out == std::vector{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    }
+
+    SUBCASE("different time_points sorted")
+    {
+        push(std::chrono::seconds{5}, 5);
+        push(std::chrono::seconds{1}, 1);
+        push(std::chrono::seconds{3}, 3);
+        push(std::chrono::seconds{1}, 2);
+        push(std::chrono::seconds{0}, 0);
+        push(std::chrono::seconds{3}, 4);
+        push(std::chrono::seconds{6}, 6);
+
+        drain();
+        CHECK(out == std::vector{0, 1, 2, 3, 4, 5, 6});
+    }
+
+    SUBCASE("a lot of random time_points sorted")
+    {
+        std::vector<int> expected{};
+        for (int i = 0; i < 1000; ++i)
+        {
+            const auto value = (i * 7919) % 1000;
+            push(std::chrono::milliseconds{value}, value);
+            expected.push_back(value);
+        }
+        std::sort(expected.begin(), expected.end());
+
+        drain();
+        CHECK(out == expected);
+    }
+
+    SUBCASE("disposed schedulables removed without reaching top")
+    {
+        std::vector<rpp::composite_disposable_wrapper> disposables{};
+        std::vector<int>                               expected{};
+        for (int i = 0; i < 1000; ++i)
+        {
+            const auto value = (i * 7919) % 1000;
+            disposables.push_back(rpp::composite_disposable_wrapper::make());
+            queue.emplace(now + std::chrono::milliseconds{value}, [&out, value](const auto&) {
+                out.push_back(value);
+                return rpp::schedulers::optional_delay_from_now{};
+            },
+                          mock_observer_strategy<int>{}.get_observer(disposables.back()).as_dynamic());
+            if (value % 10 == 0)
+                expected.push_back(value);
+        }
+        std::sort(expected.begin(), expected.end());
+
+        for (size_t i = 0; i < disposables.size(); ++i)
+        {
+            if ((i * 7919) % 1000 % 10 != 0)
+                disposables[i].dispose();
+        }
+
+        for (int i = 0; i < 1000; ++i)
+            push(std::chrono::hours{1}, 1000);
+
+        CHECK(queue.size() < 1500);
+
+        drain();
+        expected.insert(expected.end(), 1000, 1000);
+        CHECK(out == expected);
+    }
+}
+
+TEST_CASE("work_stealing_pool executes schedulables of same worker serially and in order")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    auto scheduler = rpp::schedulers::work_stealing_pool{4};
+    auto worker    = scheduler.create_worker();
+
+    std::atomic_int    in_progress{};
+    std::atomic_bool   concurrent_execution{};
+    std::vector<int>   executions{};
+    std::promise<void> done{};
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        worker.schedule([&, i](const auto&) {
+            if (in_progress.fetch_add(1) != 0)
+                concurrent_execution.store(true);
+            executions.push_back(i);
+            in_progress.fetch_sub(1);
+
+            if (i == 999)
+                done.set_value();
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+    }
+
+    done.get_future().get();
+
+    CHECK(!concurrent_execution.load());
+    REQUIRE(executions.size() == 1000);
+    CHECK(std::is_sorted(executions.begin(), executions.end()));
+}
+
+TEST_CASE("work_stealing_pool steals workers from busy thread")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    auto scheduler = rpp::schedulers::work_stealing_pool{2};
+
+    std::atomic_bool   release_busy_worker{};
+    std::promise<bool> other_worker_executed{};
+    std::promise<void> busy_worker_finished{};
+
+    const auto busy_worker  = scheduler.create_worker();
+    const auto other_worker = scheduler.create_worker();
+
+    busy_worker.schedule([&](const auto& obs) {
+        // scheduled from the pool thread, so goes to the local queue of this busy thread
+        other_worker.schedule([&](const auto&) {
+            other_worker_executed.set_value(true);
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                              obs);
+
+        while (!release_busy_worker.load())
+            std::this_thread::yield();
+        busy_worker_finished.set_value();
+        return rpp::schedulers::optional_delay_from_now{};
+    },
+                         obs);
+
+    auto f = other_worker_executed.get_future();
+    CHECK(f.wait_for(std::chrono::seconds{5}) == std::future_status::ready);
+    release_busy_worker.store(true);
+    busy_worker_finished.get_future().get();
+}
+
+TEST_CASE("work_stealing_pool respects delays")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    auto scheduler = rpp::schedulers::work_stealing_pool{2};
+    auto worker    = scheduler.create_worker();
+
+    const auto                     diff = std::chrono::milliseconds{100};
+    std::promise<std::vector<int>> done{};
+    std::vector<int>               executions{};
+
+    const auto now = rpp::schedulers::clock_type::now();
+    worker.schedule(diff * 2, [&](const auto&) {
+        executions.push_back(2);
+        done.set_value(executions);
+        return rpp::schedulers::optional_delay_from_now{};
+    },
+                    obs);
+    worker.schedule(diff, [&](const auto&) {
+        executions.push_back(1);
+        return rpp::schedulers::optional_delay_from_now{};
+    },
+                    obs);
+
+    CHECK(done.get_future().get() == std::vector{1, 2});
+    CHECK(rpp::schedulers::clock_type::now() - now >= diff * 2);
+}
+
+TEST_CASE("work_stealing_pool finishes ready schedulables and drops delayed ones on destruction")
+{
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    std::atomic_bool ready_executed{};
+    std::atomic_bool delayed_executed{};
+
+    const auto now = rpp::schedulers::clock_type::now();
+    {
+        auto scheduler = rpp::schedulers::work_stealing_pool{2};
+        auto worker    = scheduler.create_worker();
+
+        worker.schedule([&](const auto&) {
+            std::this_thread::sleep_for(std::chrono::milliseconds{50});
+            ready_executed = true;
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+        worker.schedule(std::chrono::seconds{10}, [&](const auto&) {
+            delayed_executed = true;
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+    }
+
+    CHECK(ready_executed);
+    CHECK_FALSE(delayed_executed);
+    CHECK(rpp::schedulers::clock_type::now() - now < std::chrono::seconds{5});
+}
+
+TEST_CASE("timing_wheel expires schedulables by ticks")
+{
+    const auto                            start = rpp::schedulers::time_point{};
+    rpp::schedulers::details::timing_wheel wheel{std::chrono::milliseconds{1}, start};
+
+    auto obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    std::vector<int> out{};
+    const auto       push = [&](rpp::schedulers::duration delay, int value, const auto& observer) {
+        wheel.emplace(rpp::schedulers::details::make_schedulable<rpp::schedulers::current_thread::worker_strategy>(start + delay, [&out, value](const auto&) {
+            out.push_back(value);
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                                                                                                                    observer));
+    };
+
+    const auto advance = [&](rpp::schedulers::duration to) {
+        std::vector<rpp::schedulers::details::schedulable_ptr> expired{};
+        wheel.advance(start + to, expired);
+        for (auto& schedulable : expired)
+            (*schedulable)();
+    };
+
+    SUBCASE("schedulables from all levels expire in order of ticks")
+    {
+        std::vector<int> expected{};
+        for (int i = 0; i < 1000; ++i)
+        {
+            // covers all levels and overflow bucket
+            const auto value = (i * 7919) % 1000;
+            push(std::chrono::milliseconds{value * value * 50}, value, obs);
+            expected.push_back(value);
+        }
+        std::sort(expected.begin(), expected.end());
+
+        advance(std::chrono::milliseconds{500 * 500 * 50});
+        CHECK(out == std::vector(expected.begin(), expected.begin() + 501));
+
+        advance(std::chrono::milliseconds{1000 * 1000 * 50});
+        CHECK(wheel.is_empty());
+        CHECK(out == expected);
+    }
+
+    SUBCASE("schedulable is never expired before its time_point")
+    {
+        push(std::chrono::microseconds{1500}, 1, obs);
+
+        advance(std::chrono::milliseconds{1});
+        CHECK(out.empty());
+        CHECK(wheel.get_next_timepoint() == start + std::chrono::microseconds{1500});
+
+        advance(std::chrono::milliseconds{2});
+        CHECK(out == std::vector{1});
+    }
+
+    SUBCASE("disposed schedulables removed without expiration")
+    {
+        auto d = rpp::composite_disposable_wrapper::make();
+        for (int i = 0; i < 1000; ++i)
+            push(std::chrono::hours{1}, i, mock_observer_strategy<int>{}.get_observer(d).as_dynamic());
+        d.dispose();
+
+        for (int i = 0; i < 100; ++i)
+            push(std::chrono::hours{1}, i, obs);
+
+        CHECK(wheel.size() <= 200);
+    }
+}
+
+TEST_CASE("timer_wheel with manual dispatch")
+{
+    auto scheduler = rpp::schedulers::timer_wheel{std::chrono::milliseconds{1}, rpp::schedulers::timer_wheel::mode::manual_dispatch};
+    auto worker    = scheduler.create_worker();
+    auto obs       = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+
+    std::vector<int> out{};
+    worker.schedule(std::chrono::milliseconds{20}, [&out](const auto&) { out.push_back(2); return rpp::schedulers::optional_delay_from_now{}; }, obs);
+    worker.schedule([&out](const auto&) { out.push_back(1); return rpp::schedulers::optional_delay_from_now{}; }, obs);
+
+    CHECK(out.empty());
+
+    scheduler.dispatch_if_ready();
+    CHECK(out == std::vector{1});
+    CHECK(!scheduler.is_empty());
+
+    scheduler.dispatch();
+    CHECK(out == std::vector{1, 2});
+    CHECK(scheduler.is_empty());
+}
+
+TEST_CASE("instrumented scheduler reports activity to observer")
+{
+    rpp::schedulers::scheduler_statistics statistics{};
+    rpp::schedulers::test_scheduler       original{};
+
+    auto scheduler = rpp::schedulers::instrumented{original, statistics};
+    auto worker    = scheduler.create_worker();
+    auto d         = rpp::composite_disposable_wrapper::make();
+    auto obs       = mock_observer_strategy<int>{}.get_observer(d).as_dynamic();
+
+    SUBCASE("lag, runtime and queue depth are reported")
+    {
+        size_t executions{};
+        worker.schedule(std::chrono::seconds{5}, [&executions](const auto&) {
+            rpp::schedulers::test_scheduler::s_current_time += std::chrono::seconds{1};
+            return ++executions == 1 ? rpp::schedulers::optional_delay_from_now{std::chrono::seconds{3}} : rpp::schedulers::optional_delay_from_now{};
+        },
+                        obs);
+
+        auto snapshot = statistics.snapshot();
+        CHECK(snapshot.enqueued == 1);
+        CHECK(snapshot.queue_depth() == 1);
+        REQUIRE(snapshot.workers.size() == 1);
+        CHECK(snapshot.workers[0].queue_depth == 1);
+
+        original.time_advance(std::chrono::seconds{7});
+        snapshot = statistics.snapshot();
+        CHECK(executions == 1);
+        CHECK(snapshot.enqueued == 2);
+        CHECK(snapshot.dequeued == 1);
+        CHECK(snapshot.queue_depth() == 1);
+        CHECK(snapshot.lag.count == 1);
+        CHECK(snapshot.lag.max == std::chrono::seconds{2});
+        CHECK(snapshot.runtime.max == std::chrono::seconds{1});
+
+        original.time_advance(std::chrono::seconds{3});
+        snapshot = statistics.snapshot();
+        CHECK(executions == 2);
+        CHECK(snapshot.queue_depth() == 0);
+        CHECK(snapshot.lag.max == std::chrono::seconds{2});
+        CHECK(snapshot.runtime.count == 2);
+        CHECK(snapshot.workers[0].executed == 2);
+        CHECK(snapshot.workers[0].busy == std::chrono::seconds{2});
+    }
+
+    SUBCASE("schedulable of disposed handler is reported as dropped")
+    {
+        worker.schedule(std::chrono::seconds{5}, [](const auto&) { return rpp::schedulers::optional_delay_from_now{}; }, obs);
+        d.dispose();
+        original.time_advance(std::chrono::seconds{5});
+
+        const auto snapshot = statistics.snapshot();
+        CHECK(snapshot.dropped == 1);
+        CHECK(snapshot.queue_depth() == 0);
+        CHECK(snapshot.lag.count == 0);
+    }
+
+    SUBCASE("statistics of destroyed workers are kept")
+    {
+        {
+            auto other = scheduler.create_worker();
+            other.schedule([](const auto&) { return rpp::schedulers::optional_delay_from_now{}; }, obs);
+        }
+
+        const auto snapshot = statistics.snapshot();
+        CHECK(snapshot.workers.size() == 1);
+        CHECK(snapshot.enqueued == 1);
+        CHECK(snapshot.dequeued == 1);
+    }
+}
+
+TEST_CASE("latency_histogram collects durations by power-of-two buckets")
+{
+    rpp::schedulers::latency_histogram histogram{};
+    for (int i = 0; i < 99; ++i)
+        histogram.record(std::chrono::nanoseconds{100});
+    histogram.record(std::chrono::microseconds{100});
+
+    const auto snapshot = histogram.snapshot();
+    CHECK(snapshot.count == 100);
+    CHECK(snapshot.max == std::chrono::microseconds{100});
+    CHECK(snapshot.mean() == std::chrono::nanoseconds{(99 * 100 + 100'000) / 100});
+    CHECK(snapshot.percentile(0.5) == std::chrono::nanoseconds{127});
+    CHECK(snapshot.percentile(0.99) == std::chrono::nanoseconds{127});
+    CHECK(snapshot.percentile(1.0) == std::chrono::microseconds{100});
+}
+
+namespace
+{
+    struct throwing_batch_strategy
+    {
+        template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, rpp::schedulers::constraint::schedulable_fn<Handler, Args...> Fn>
+        void defer_to(rpp::schedulers::time_point, Fn&&, Handler&&, Args&&...) const
+        {
+        }
+
+        void defer_batch(std::vector<rpp::schedulers::details::schedulable_ptr>&&) const
+        {
+            throw std::runtime_error{"defer_batch"};
+        }
+
+        static rpp::schedulers::time_point now() { return rpp::schedulers::clock_type::now(); }
+    };
+} // namespace
+
+TEST_CASE("worker schedules batch at once")
+{
+    static_assert(rpp::schedulers::constraint::batch_strategy<rpp::schedulers::new_thread::worker_strategy>);
+    static_assert(!rpp::schedulers::constraint::batch_strategy<rpp::schedulers::immediate::worker_strategy>);
+
+    auto             obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+    std::vector<int> out{};
+
+    const auto push = [&out](int v) {
+        return [&out, v](const auto&) {
+            out.push_back(v);
+            return rpp::schedulers::optional_delay_from_now{};
+        };
+    };
+
+    SUBCASE("run_loop receives batch only after batch is finished")
+    {
+        auto scheduler = rpp::schedulers::run_loop{};
+        auto worker    = scheduler.create_worker();
+
+        worker.schedule_batch([&](auto& batch) {
+            batch.schedule(std::chrono::milliseconds{1}, push(3), obs);
+            batch.schedule(push(1), obs);
+            batch.schedule(push(2), obs);
+            CHECK(scheduler.is_empty());
+        });
+
+        CHECK(!scheduler.is_empty());
+        while (!scheduler.is_empty())
+            scheduler.dispatch();
+        CHECK(out == std::vector{1, 2, 3});
+    }
+
+    SUBCASE("new_thread executes batch in order")
+    {
+        auto               worker = rpp::schedulers::new_thread::create_worker();
+        std::promise<void> done{};
+
+        worker.schedule_batch([&](auto& batch) {
+            for (int i = 0; i < 100; ++i)
+                batch.schedule(push(i), obs);
+
+            batch.schedule([&done](const auto&) {
+                done.set_value();
+                return rpp::schedulers::optional_delay_from_now{};
+            },
+                           obs);
+        });
+
+        done.get_future().wait();
+        REQUIRE(out.size() == 100);
+        CHECK(std::is_sorted(out.begin(), out.end()));
+    }
+
+    SUBCASE("batch forwards failed submission to handlers on destruction")
+    {
+        auto mock   = mock_observer_strategy<int>{};
+        auto worker = rpp::schedulers::worker<throwing_batch_strategy>{};
+
+        worker.schedule_batch([&](auto& batch) {
+            batch.schedule(push(1), mock.get_observer().as_dynamic());
+            batch.schedule(push(2), mock.get_observer().as_dynamic());
+        });
+
+        CHECK(out.empty());
+        CHECK(mock.get_on_error_count() == 2);
+    }
+
+    SUBCASE("strategy without batch support schedules immediately")
+    {
+        auto worker = rpp::schedulers::immediate::create_worker();
+
+        worker.schedule_batch([&](auto& batch) {
+            batch.schedule(push(1), obs);
+            CHECK(out == std::vector{1});
+        });
+    }
+}
+
+TEST_CASE("new_thread respects idle policy")
+{
+    const auto test_policy = [](rpp::schedulers::idle_policy policy) {
+        auto obs  = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+        auto done = std::make_shared<std::atomic_bool>();
+
+        std::vector<int>   out{};
+        std::promise<void> executed{};
+        {
+            auto       worker = std::optional{rpp::schedulers::new_thread::with_idle_policy(policy).create_worker()};
+            const auto start  = rpp::schedulers::clock_type::now();
+
+            worker->schedule(std::chrono::milliseconds{10}, [&out, &executed, start](const auto&) {
+                CHECK(rpp::schedulers::clock_type::now() - start >= std::chrono::milliseconds{10});
+                out.push_back(2);
+                executed.set_value();
+                return rpp::schedulers::optional_delay_from_now{};
+            },
+                             obs);
+
+            std::thread{[&] {
+                worker->schedule([&out, done](const auto&) {
+                    thread_local rpp::utils::finally_action s_a{[done] {
+                        done->store(true);
+                    }};
+                    out.push_back(1);
+                    return rpp::schedulers::optional_delay_from_now{};
+                },
+                                 obs);
+            }}.join();
+
+            executed.get_future().wait();
+            CHECK(out == std::vector{1, 2});
+        }
+
+        // thread is finished after destruction of worker even with hot policy
+        while (!done->load())
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    };
+
+    SUBCASE("blocking")
+    {
+        test_policy(rpp::schedulers::idle_policy::blocking());
+    }
+
+    SUBCASE("spin_then_park")
+    {
+        test_policy(rpp::schedulers::idle_policy::spin_then_park());
+    }
+
+    SUBCASE("hot")
+    {
+        test_policy(rpp::schedulers::idle_policy::hot());
+    }
+}
+
+TEST_CASE_TEMPLATE("worker knows if it is current executor", TestType, rpp::schedulers::new_thread, rpp::schedulers::thread_pool, rpp::schedulers::work_stealing_pool)
+{
+    auto obs    = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+    auto worker = TestType{}.create_worker();
+    auto other  = TestType{}.create_worker();
+
+    CHECK(!worker.is_current_executor());
+    CHECK(!rpp::schedulers::immediate::create_worker().is_current_executor());
+
+    std::promise<std::pair<bool, bool>> result{};
+    worker.schedule([&](const auto&) {
+        result.set_value({worker.is_current_executor(), other.is_current_executor()});
+        return rpp::schedulers::optional_delay_from_now{};
+    },
+                    obs);
+
+    CHECK(result.get_future().get() == std::pair{true, false});
+}
@@ -0,0 +1,176 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <doctest/doctest.h>
+
+#include <rpp/observers/mock_observer.hpp>
+#include <rpp/operators/concat.hpp>
+#include <rpp/operators/filter.hpp>
+#include <rpp/operators/map.hpp>
+#include <rpp/operators/merge.hpp>
+#include <rpp/operators/subscribe.hpp>
+#include <rpp/operators/with_demand.hpp>
+#include <rpp/schedulers/current_thread.hpp>
+#include <rpp/schedulers/immediate.hpp>
+#include <rpp/schedulers/test_scheduler.hpp>
+#include <rpp/sources/interval.hpp>
+#include <rpp/sources/just.hpp>
+#include <rpp/subjects/publish_subject.hpp>
+
+#include <chrono>
+
+TEST_CASE_TEMPLATE("with_demand limits emissions of from_iterable by demand", TestType, rpp::schedulers::immediate, rpp::schedulers::current_thread)
+{
+    auto mock   = mock_observer_strategy<int>{};
+    auto demand = rpp::demand::make(2);
+
+    SUBCASE("source emits only requested values")
+    {
+        rpp::source::just(TestType{}, 1, 2, 3, 4, 5) | rpp::ops::with_demand(demand) | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector{1, 2});
+        CHECK(mock.get_on_completed_count() == 0);
+
+        SUBCASE("source continues emissions on request")
+        {
+            demand.request(2);
+            CHECK(mock.get_received_values() == std::vector{1, 2, 3, 4});
+            CHECK(mock.get_on_completed_count() == 0);
+
+            demand.request(10);
+            CHECK(mock.get_received_values() == std::vector{1, 2, 3, 4, 5});
+            CHECK(mock.get_on_completed_count() == 1);
+        }
+    }
+    SUBCASE("observer requesting values from on_next obtains all of them")
+    {
+        std::vector<int> values{};
+        size_t           completed{};
+        rpp::source::just(TestType{}, 1, 2, 3) | rpp::ops::with_demand(rpp::demand::make(1)) | rpp::ops::subscribe([&](int v) { values.push_back(v); }, [&]() { ++completed; });
+        CHECK(values == std::vector{1});
+
+        rpp::demand self_requesting = rpp::demand::make(1);
+        values.clear();
+        rpp::source::just(TestType{}, 1, 2, 3) | rpp::ops::with_demand(self_requesting) | rpp::ops::subscribe([&](int v) { values.push_back(v); self_requesting.request(1); }, [&]() { ++completed; });
+        CHECK(values == std::vector{1, 2, 3});
+        CHECK(completed == 1);
+    }
+    SUBCASE("map passes demand through")
+    {
+        rpp::source::just(TestType{}, 1, 2, 3) | rpp::ops::map([](int v) { return v * 10; }) | rpp::ops::with_demand(demand) | rpp::ops::subscribe(mock);
+        CHECK(mock.get_received_values() == std::vector{10, 20});
+    }
+    SUBCASE("filter gives back demand of filtered out values")
+    {
+        rpp::source::just(TestType{}, 1, 2, 3, 4, 5, 6) | rpp::ops::filter([](int v) { return v % 2 == 0; }) | rpp::ops::with_demand(demand) | rpp::ops::subscribe(mock);
+        CHECK(mock.get_received_values() == std::vector{2, 4});
+        CHECK(demand.try_consume() == false);
+
+        demand.request(1);
+        CHECK(mock.get_received_values() == std::vector{2, 4, 6});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+}
+
+TEST_CASE("inner observables of merge and concat share demand")
+{
+    auto mock   = mock_observer_strategy<int>{};
+    auto demand = rpp::demand::make(3);
+
+    SUBCASE("merge")
+    {
+        rpp::source::just(rpp::schedulers::immediate{}, rpp::source::just(rpp::schedulers::immediate{}, 1, 2), rpp::source::just(rpp::schedulers::immediate{}, 3, 4))
+            | rpp::ops::merge()
+            | rpp::ops::with_demand(demand)
+            | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3});
+        CHECK(mock.get_on_completed_count() == 0);
+
+        demand.request(1);
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3, 4});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+    SUBCASE("concat")
+    {
+        rpp::source::just(rpp::schedulers::immediate{}, rpp::source::just(rpp::schedulers::immediate{}, 1, 2), rpp::source::just(rpp::schedulers::immediate{}, 3, 4))
+            | rpp::ops::concat()
+            | rpp::ops::with_demand(demand)
+            | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3});
+        CHECK(mock.get_on_completed_count() == 0);
+
+        demand.request(1);
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3, 4});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+}
+
+TEST_CASE("filter doesn't give back demand not consumed by upstream")
+{
+    auto                                mock   = mock_observer_strategy<int>{};
+    auto                                demand = rpp::demand::make(2);
+    rpp::subjects::publish_subject<int> subject{};
+
+    SUBCASE("publish_subject upstream")
+    {
+        subject.get_observable() | rpp::ops::filter([](int v) { return v % 2 == 0; }) | rpp::ops::with_demand(demand) | rpp::ops::subscribe(mock);
+        for (int v : {1, 3, 5})
+            subject.get_observer().on_next(v);
+
+        CHECK(demand.try_consume());
+        CHECK(demand.try_consume());
+        CHECK(!demand.try_consume());
+    }
+    SUBCASE("publish_subject merged with demand-aware source")
+    {
+        subject.get_observable() | rpp::ops::filter([](int v) { return v % 2 == 0; })
+            | rpp::ops::merge_with(rpp::source::just(rpp::schedulers::immediate{}, 10, 20, 30, 40))
+            | rpp::ops::with_demand(demand)
+            | rpp::ops::subscribe(mock);
+        CHECK(mock.get_received_values() == std::vector{10, 20});
+
+        for (int v : {1, 3, 5})
+            subject.get_observer().on_next(v);
+        CHECK(mock.get_received_values() == std::vector{10, 20});
+
+        demand.request(1);
+        CHECK(mock.get_received_values() == std::vector{10, 20, 30});
+    }
+}
+
+TEST_CASE("interval skips ticks without demand")
+{
+    auto scheduler = rpp::schedulers::test_scheduler{};
+    auto mock      = mock_observer_strategy<size_t>{};
+    auto demand    = rpp::demand::make(1);
+    auto interval  = std::chrono::seconds{1};
+
+    rpp::source::interval(interval, scheduler) | rpp::ops::with_demand(demand) | rpp::ops::subscribe(mock);
+
+    for (size_t i = 0; i < 3; ++i)
+        scheduler.time_advance(interval);
+    CHECK(mock.get_received_values() == std::vector<size_t>{0});
+
+    demand.request(1);
+    scheduler.time_advance(interval);
+    CHECK(mock.get_received_values() == std::vector<size_t>{0, 3});
+}
+
+TEST_CASE("plain observer has unbounded demand")
+{
+    auto mock = mock_observer_strategy<int>{};
+    CHECK(mock.get_observer().get_demand().is_unbounded());
+
+    rpp::source::just(1, 2, 3) | rpp::ops::filter([](int v) { return v != 2; }) | rpp::ops::subscribe(mock);
+    CHECK(mock.get_received_values() == std::vector{1, 3});
+    CHECK(mock.get_on_completed_count() == 1);
+}
@@ -25,6 +25,7 @@
 #include "rpp_trompeloil.hpp"
 
 #include <chrono>
+#include <vector>
 
 using namespace std::chrono_literals;
 
@@ -163,3 +164,27 @@ TEST_CASE("strand worker has correct execution order")
     context.run_one();
     CHECK(has_run_first_task);
 }
+
+TEST_CASE("strand worker executes batch via single handler")
+{
+    asio::io_context context;
+    auto             obs = mock_observer_strategy<int>{}.get_observer().as_dynamic();
+    std::vector<int> executions{};
+
+    auto worker = rppasio::schedulers::strand{context.get_executor()}.create_worker();
+
+    worker.schedule_batch([&](auto& batch) {
+        for (int i = 0; i < 3; ++i)
+        {
+            batch.schedule(
+                [&executions, i](const auto&) {
+                    executions.push_back(i);
+                    return rpp::schedulers::optional_delay_from_now{};
+                },
+                obs);
+        }
+    });
+
+    context.run_one();
+    CHECK(executions == std::vector{0, 1, 2});
+}